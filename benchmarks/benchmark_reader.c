@@ -0,0 +1,640 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/reader.h"
+#include "mpio/file.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define BENCHMARK_FILE_NAME "benchmark-conf.txt"
+#define BENCHMARK_IMAGE_FILE_NAME "benchmark-conf-image.bin"
+
+inline static double getBenchmarkTime()
+{
+#if _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1000000000.0;
+#endif
+}
+
+inline static char* createBenchmarkData(size_t itemCount, size_t* dataSize)
+{
+	assert(dataSize);
+
+	// Note: each generated line is shorter than 64 characters.
+	char* data = malloc(itemCount * 64 + 1);
+	if (!data)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		return NULL;
+	}
+
+	size_t size = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		if (i % 16 == 0)
+			size += sprintf(data + size, "# Generated section %llu\n", (long long unsigned int)i);
+
+		switch (i % 4)
+		{
+		case 0:
+			size += sprintf(data + size, "integer.%llu: %llu\n",
+				(long long unsigned int)i, (long long unsigned int)(i * 7919));
+			break;
+		case 1:
+			size += sprintf(data + size, "floating.%llu: %llu.%03llu\n", (long long unsigned int)i,
+				(long long unsigned int)i, (long long unsigned int)(i % 1000));
+			break;
+		case 2:
+			size += sprintf(data + size, "boolean.%llu: %s\n",
+				(long long unsigned int)i, i % 3 == 0 ? "true" : "false");
+			break;
+		default:
+			size += sprintf(data + size, "string.%llu: Some string value %llu\n",
+				(long long unsigned int)i, (long long unsigned int)i);
+			break;
+		}
+	}
+
+	*dataSize = size;
+	return data;
+}
+inline static bool createBenchmarkFile(const char* data, size_t dataSize)
+{
+	assert(data);
+
+	FILE* file = openFile(BENCHMARK_FILE_NAME, "wb");
+	if (!file)
+	{
+		printf("Failed to open benchmark file.\n");
+		return false;
+	}
+
+	size_t writeResult = fwrite(data, sizeof(char), dataSize, file);
+	closeFile(file);
+
+	if (writeResult != dataSize)
+	{
+		printf("Failed to write benchmark file.\n");
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+inline static bool benchmarkFileReader(size_t itemCount)
+{
+	size_t dataSize;
+	char* data = createBenchmarkData(itemCount, &dataSize);
+	if (!data)
+		return false;
+
+	bool result = createBenchmarkFile(data, dataSize);
+	free(data);
+	if (!result)
+		return false;
+
+	double megabytes = (double)dataSize / (1024.0 * 1024.0);
+
+	FILE* file = openFile(BENCHMARK_FILE_NAME, "rb");
+	if (!file)
+	{
+		printf("Failed to open benchmark file.\n");
+		return false;
+	}
+
+	// Note: per-character stdio reading is what the old reader did before parsing.
+	double startTime = getBenchmarkTime();
+	size_t charCount = 0;
+	while (getc(file) != EOF)
+		charCount++;
+	double getcTime = getBenchmarkTime() - startTime;
+	closeFile(file);
+
+	ConfReader confReader; size_t errorLine;
+	startTime = getBenchmarkTime();
+	ConfResult confResult = createFileConfReader(BENCHMARK_FILE_NAME, &confReader, &errorLine);
+	double readerTime = getBenchmarkTime() - startTime;
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkFileReader: failed to read file. (%s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		remove(BENCHMARK_FILE_NAME);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	remove(BENCHMARK_FILE_NAME);
+
+	printf("File reader: %.2f MB, getc scan %.3f s (%.1f MB/s), "
+		"createFileConfReader %.3f s (%.1f MB/s)\n", megabytes,
+		getcTime, megabytes / getcTime, readerTime, megabytes / readerTime);
+	return charCount == dataSize;
+}
+
+inline static bool benchmarkParseThroughput(size_t lineCount, size_t valueSize)
+{
+	char* data = malloc(lineCount * (valueSize + 32) + 1);
+	if (!data)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (size_t i = 0; i < lineCount; i++)
+	{
+		dataSize += sprintf(data + dataSize, "string.value.%llu: ", (long long unsigned int)i);
+		for (size_t j = 0; j < valueSize; j++)
+			data[dataSize++] = (char)('a' + (i + j) % 26);
+		data[dataSize++] = '\n';
+	}
+	data[dataSize] = '\0';
+
+	const int iterationCount = 8;
+	double gigabytes = (double)dataSize * iterationCount / (1024.0 * 1024.0 * 1024.0);
+
+	// Note: reference byte loop, branching on every character like the old parser did.
+	double startTime = getBenchmarkTime();
+	size_t separatorCount = 0;
+	for (int i = 0; i < iterationCount; i++)
+	{
+		bool hasSeparator = false;
+		for (size_t j = 0; j < dataSize; j++)
+		{
+			char currentChar = data[j];
+			if (currentChar == ':' && !hasSeparator)
+			{
+				hasSeparator = true;
+				separatorCount++;
+			}
+			else if (currentChar == '\n' || currentChar == '\0')
+				hasSeparator = false;
+			else if (currentChar == '#' || currentChar == '\r')
+				separatorCount += 2;
+		}
+	}
+	double byteLoopTime = getBenchmarkTime() - startTime;
+
+	startTime = getBenchmarkTime();
+	for (int i = 0; i < iterationCount; i++)
+	{
+		ConfReader confReader; size_t errorLine;
+		ConfResult confResult = createBorrowedDataConfReader(data, dataSize, &confReader, &errorLine);
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			printf("benchmarkParseThroughput: failed to parse data. (%s, line: %llu)\n",
+				confResultToString(confResult), (long long unsigned int)errorLine);
+			free(data);
+			return false;
+		}
+		destroyConfReader(confReader);
+	}
+	double parseTime = getBenchmarkTime() - startTime;
+	free(data);
+
+	printf("Parse throughput: %llu lines x %llu bytes, byte loop %.2f GB/s, "
+		"createBorrowedDataConfReader %.2f GB/s\n", (long long unsigned int)lineCount,
+		(long long unsigned int)valueSize, gigabytes / byteLoopTime, gigabytes / parseTime);
+	return separatorCount == lineCount * iterationCount;
+}
+
+static void onBenchmarkItem(const char* key, size_t keyLength, ConfDataType type,
+	const ConfItemValue* value, size_t line, void* context)
+{
+	(void)key; (void)keyLength; (void)line;
+	if (type == INTEGER_CONF_DATA_TYPE)
+		*(int64_t*)context += value->integer;
+}
+
+inline static bool benchmarkOneShotLoad(size_t itemCount)
+{
+	char* data = malloc(itemCount * 40 + 1);
+	if (!data)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		dataSize += sprintf(data + dataSize, "section.key.%llu: %llu\n",
+			(long long unsigned int)i, (long long unsigned int)i);
+	}
+
+	// Note: one-shot load copies every value once, either from the reader or the callback.
+	double startTime = getBenchmarkTime();
+	ConfReader confReader; size_t errorLine;
+	ConfResult confResult = createBorrowedDataConfReader(data, dataSize, &confReader, &errorLine);
+	int64_t readerSum = 0, value;
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		size_t count = getConfReaderItemCount(confReader);
+		for (size_t i = 0; i < count; i++)
+		{
+			if (getConfReaderIntAt(confReader, i, &value))
+				readerSum += value;
+		}
+		destroyConfReader(confReader);
+	}
+	double readerTime = getBenchmarkTime() - startTime;
+
+	int64_t streamSum = 0, checkedSum = 0;
+	startTime = getBenchmarkTime();
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = parseConfData(data, dataSize, onBenchmarkItem, &streamSum, false, &errorLine);
+	double streamTime = getBenchmarkTime() - startTime;
+
+	startTime = getBenchmarkTime();
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = parseConfData(data, dataSize, onBenchmarkItem, &checkedSum, true, &errorLine);
+	double checkedTime = getBenchmarkTime() - startTime;
+	free(data);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkOneShotLoad: failed to parse data. (%s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+
+	printf("One-shot load: %llu items, reader %.3f s, parseConfData %.3f s, "
+		"with repeat check %.3f s\n", (long long unsigned int)itemCount, readerTime, streamTime, checkedTime);
+	return readerSum == streamSum && streamSum == checkedSum;
+}
+
+inline static bool benchmarkIndexBuild(size_t itemCount)
+{
+	char* data = malloc(itemCount * 40 + 1);
+	if (!data)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		return false;
+	}
+
+	// Note: keys are shuffled with a multiplicative permutation to avoid presorted input.
+	size_t dataSize = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		long long unsigned int index = (long long unsigned int)(((uint64_t)i * 2654435761u) % itemCount);
+		dataSize += sprintf(data + dataSize, "generated.key.%llu: %llu\n", index, index);
+	}
+
+	ConfReader confReader; size_t errorLine;
+	double startTime = getBenchmarkTime();
+	ConfResult confResult = createBorrowedDataConfReader(data, dataSize, &confReader, &errorLine);
+	double buildTime = getBenchmarkTime() - startTime;
+	free(data);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkIndexBuild: failed to parse data. (%s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	printf("Index build: %llu keys, %.3f s (%.1f ns/key)\n", (long long unsigned int)itemCount,
+		buildTime, buildTime * 1000000000.0 / (double)itemCount);
+	return true;
+}
+
+inline static double measureLookups(ConfReader confReader, size_t itemCount, int64_t* checksum)
+{
+	char key[40];
+	double startTime = getBenchmarkTime();
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		long long unsigned int index = (long long unsigned int)(((uint64_t)i * 2654435761u) % itemCount);
+		sprintf(key, "generated.key.%llu", index);
+
+		int64_t integer;
+		if (getConfReaderInt(confReader, key, &integer))
+			*checksum += integer;
+	}
+	return getBenchmarkTime() - startTime;
+}
+inline static bool benchmarkLookup(size_t itemCount)
+{
+	char* data = malloc(itemCount * 40 + 1);
+	if (!data)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (size_t i = 0; i < itemCount; i++)
+		dataSize += sprintf(data + dataSize, "generated.key.%llu: %llu\n",
+			(long long unsigned int)i, (long long unsigned int)i);
+
+	ConfReader confReader; size_t errorLine;
+	ConfResult confResult = createDataConfReaderN(data, dataSize, &confReader, &errorLine);
+	free(data);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkLookup: failed to parse data. (%s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+
+	int64_t checksum = 0;
+	double searchTime = measureLookups(confReader, itemCount, &checksum);
+
+	double startTime = getBenchmarkTime();
+	confResult = buildConfReaderHashIndex(confReader, (uint64_t)startTime);
+	double hashBuildTime = getBenchmarkTime() - startTime;
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkLookup: failed to build hash index. (%s)\n", confResultToString(confResult));
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	double hashTime = measureLookups(confReader, itemCount, &checksum);
+	destroyConfReader(confReader);
+
+	int64_t expected = (int64_t)itemCount * ((int64_t)itemCount - 1);
+	if (checksum != expected)
+	{
+		printf("benchmarkLookup: incorrect checksum.\n");
+		return false;
+	}
+
+	printf("Lookup: %llu keys, binary search %.1f ns/key, hash index %.1f ns/key (build %.1f ns/key)\n",
+		(long long unsigned int)itemCount, searchTime * 1000000000.0 / (double)itemCount,
+		hashTime * 1000000000.0 / (double)itemCount, hashBuildTime * 1000000000.0 / (double)itemCount);
+	return true;
+}
+inline static bool benchmarkBatchLookup(size_t itemCount, size_t lookupCount)
+{
+	char* data = malloc(itemCount * 40 + 1);
+	char* keys = malloc(lookupCount * 40);
+	ConfLookup* lookups = malloc(lookupCount * sizeof(ConfLookup));
+	int64_t* values = malloc(lookupCount * sizeof(int64_t));
+
+	if (!data || !keys || !lookups || !values)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		free(data); free(keys); free(lookups); free(values);
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (size_t i = 0; i < itemCount; i++)
+		dataSize += sprintf(data + dataSize, "generated.key.%llu: %llu\n",
+			(long long unsigned int)i, (long long unsigned int)i);
+
+	ConfReader confReader; size_t errorLine;
+	ConfResult confResult = createDataConfReaderN(data, dataSize, &confReader, &errorLine);
+	free(data);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkBatchLookup: failed to parse data. (%s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		free(keys); free(lookups); free(values);
+		return false;
+	}
+
+	for (size_t i = 0; i < lookupCount; i++)
+	{
+		char* key = keys + i * 40;
+		long long unsigned int index = (long long unsigned int)(((uint64_t)i * 2654435761u) % itemCount);
+		lookups[i].key = key;
+		lookups[i].keyLength = (size_t)sprintf(key, "generated.key.%llu", index);
+		lookups[i].type = INTEGER_CONF_DATA_TYPE;
+		lookups[i].value = &values[i];
+		lookups[i].length = NULL;
+	}
+
+	const int repeatCount = 10;
+	int64_t checksum = 0;
+
+	double startTime = getBenchmarkTime();
+	for (int r = 0; r < repeatCount; r++)
+	{
+		for (size_t i = 0; i < lookupCount; i++)
+		{
+			if (getConfReaderIntN(confReader, lookups[i].key, lookups[i].keyLength, &values[i]))
+				checksum += values[i];
+		}
+	}
+	double singleTime = getBenchmarkTime() - startTime;
+
+	startTime = getBenchmarkTime();
+	for (int r = 0; r < repeatCount; r++)
+	{
+		getConfReaderBatch(confReader, lookups, lookupCount, NULL);
+		for (size_t i = 0; i < lookupCount; i++)
+			checksum -= values[i];
+	}
+	double batchTime = getBenchmarkTime() - startTime;
+	destroyConfReader(confReader);
+	free(keys); free(lookups); free(values);
+
+	if (checksum != 0)
+	{
+		printf("benchmarkBatchLookup: incorrect checksum.\n");
+		return false;
+	}
+
+	double lookupScale = 1000000000.0 / ((double)lookupCount * repeatCount);
+	printf("Batch lookup: %llu of %llu keys, single %.1f ns/key, batch %.1f ns/key (x%.2f)\n",
+		(long long unsigned int)lookupCount, (long long unsigned int)itemCount, singleTime * lookupScale,
+		batchTime * lookupScale, singleTime / batchTime);
+	return true;
+}
+
+//**********************************************************************************************************************
+inline static bool benchmarkImageLoad(size_t itemCount)
+{
+	size_t dataSize;
+	char* data = createBenchmarkData(itemCount, &dataSize);
+	if (!data)
+		return false;
+
+	bool result = createBenchmarkFile(data, dataSize);
+	free(data);
+	if (!result)
+		return false;
+
+	// Note: cold start is measured as a load and one lookup.
+	ConfReader confReader = NULL; size_t errorLine; int64_t textValue = 0, imageValue = 0, verifiedValue = 0;
+	double startTime = getBenchmarkTime();
+	ConfResult confResult = createFileConfReader(BENCHMARK_FILE_NAME, &confReader, &errorLine);
+	if (confResult == SUCCESS_CONF_RESULT)
+		getConfReaderInt(confReader, "integer.4", &textValue);
+	double textTime = getBenchmarkTime() - startTime;
+	remove(BENCHMARK_FILE_NAME);
+
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = buildConfReaderHashIndex(confReader, 0);
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = writeConfReaderImage(confReader, BENCHMARK_IMAGE_FILE_NAME);
+	destroyConfReader(confReader);
+
+	double imageTime = 0.0, verifiedTime = 0.0;
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		startTime = getBenchmarkTime();
+		confResult = createImageConfReader(BENCHMARK_IMAGE_FILE_NAME, false, &confReader);
+		if (confResult == SUCCESS_CONF_RESULT)
+		{
+			getConfReaderInt(confReader, "integer.4", &imageValue);
+			imageTime = getBenchmarkTime() - startTime;
+			destroyConfReader(confReader);
+		}
+	}
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		startTime = getBenchmarkTime();
+		confResult = createImageConfReader(BENCHMARK_IMAGE_FILE_NAME, true, &confReader);
+		if (confResult == SUCCESS_CONF_RESULT)
+		{
+			getConfReaderInt(confReader, "integer.4", &verifiedValue);
+			verifiedTime = getBenchmarkTime() - startTime;
+			destroyConfReader(confReader);
+		}
+	}
+	remove(BENCHMARK_IMAGE_FILE_NAME);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkImageLoad: failed to load. (%s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	printf("Image load: %llu items, text %.3f ms, image %.3f ms, verified image %.3f ms\n",
+		(long long unsigned int)itemCount, textTime * 1000.0, imageTime * 1000.0, verifiedTime * 1000.0);
+	return textValue == 4 * 7919 && textValue == imageValue && imageValue == verifiedValue;
+}
+
+//**********************************************************************************************************************
+static void onBenchmarkDiff(const char* key, size_t keyLength, const ConfDiff* diff, void* context)
+{
+	(void)key; (void)keyLength; (void)diff;
+	(*(size_t*)context)++;
+}
+
+inline static bool benchmarkDiff(size_t itemCount)
+{
+	char* oldData = malloc(itemCount * 40 + 1);
+	char* newData = malloc(itemCount * 40 + 1);
+	if (!oldData || !newData)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		free(newData); free(oldData);
+		return false;
+	}
+
+	// Note: every 100th value is changed in the new config.
+	size_t oldSize = 0, newSize = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		oldSize += sprintf(oldData + oldSize, "generated.key.%llu: %llu\n",
+			(long long unsigned int)i, (long long unsigned int)i);
+		newSize += sprintf(newData + newSize, "generated.key.%llu: %llu\n",
+			(long long unsigned int)i, (long long unsigned int)(i % 100 == 0 ? i + 1 : i));
+	}
+
+	ConfReader oldReader = NULL, newReader = NULL; size_t errorLine;
+	ConfResult confResult = createDataConfReaderN(oldData, oldSize, &oldReader, &errorLine);
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = createDataConfReaderN(newData, newSize, &newReader, &errorLine);
+	free(newData); free(oldData);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("benchmarkDiff: failed to parse data. (%s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		destroyConfReader(oldReader);
+		return false;
+	}
+
+	// Note: reference compares each old item with a lookup in the new reader.
+	double startTime = getBenchmarkTime();
+	size_t lookupCount = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		const char* key; size_t keyLength; ConfDataType type; int64_t oldValue, newValue;
+		getConfReaderItem(oldReader, i, &key, &keyLength, &type);
+		getConfReaderIntAt(oldReader, i, &oldValue);
+		if (!getConfReaderIntN(newReader, key, keyLength, &newValue) || oldValue != newValue)
+			lookupCount++;
+	}
+	double lookupTime = getBenchmarkTime() - startTime;
+
+	startTime = getBenchmarkTime();
+	size_t diffCount = 0;
+	size_t resultCount = diffConfReaders(oldReader, newReader, onBenchmarkDiff, &diffCount);
+	double diffTime = getBenchmarkTime() - startTime;
+
+	destroyConfReader(newReader);
+	destroyConfReader(oldReader);
+
+	printf("Diff: %llu items, per-key lookups %.3f s, diffConfReaders %.3f s (x%.1f)\n",
+		(long long unsigned int)itemCount, lookupTime, diffTime, diffTime > 0.0 ? lookupTime / diffTime : 0.0);
+	return lookupCount == diffCount && diffCount == resultCount && diffCount == (itemCount + 99) / 100;
+}
+
+//**********************************************************************************************************************
+int main(int argc, char* argv[])
+{
+	size_t maxItemCount = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+	if (maxItemCount == 0)
+		maxItemCount = 1000000;
+
+	bool result = true;
+	for (size_t itemCount = 10000; itemCount <= maxItemCount; itemCount *= 10)
+		result &= benchmarkFileReader(itemCount);
+	result &= benchmarkParseThroughput(65536, 256);
+	result &= benchmarkParseThroughput(1024, 16384);
+	for (size_t itemCount = 10000; itemCount <= maxItemCount; itemCount *= 10)
+		result &= benchmarkOneShotLoad(itemCount);
+	for (size_t itemCount = 1000; itemCount <= maxItemCount; itemCount *= 10)
+		result &= benchmarkIndexBuild(itemCount);
+	for (size_t itemCount = 1000; itemCount <= maxItemCount; itemCount *= 10)
+		result &= benchmarkLookup(itemCount);
+	for (size_t itemCount = 1000; itemCount <= maxItemCount; itemCount *= 10)
+	{
+		result &= benchmarkBatchLookup(itemCount, itemCount / 10);
+		result &= benchmarkBatchLookup(itemCount, itemCount);
+	}
+	for (size_t itemCount = 1000; itemCount <= maxItemCount; itemCount *= 10)
+		result &= benchmarkDiff(itemCount);
+	for (size_t itemCount = 10000; itemCount <= maxItemCount; itemCount *= 10)
+		result &= benchmarkImageLoad(itemCount);
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,319 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/store.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+typedef HANDLE BenchmarkThread;
+typedef SRWLOCK BenchmarkLock;
+#define BENCHMARK_THREAD_RESULT DWORD WINAPI
+#define loadBenchmarkFlag(address) InterlockedOr(address, 0)
+#define storeBenchmarkFlag(address, value) InterlockedExchange(address, value)
+#else
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+typedef pthread_t BenchmarkThread;
+typedef pthread_rwlock_t BenchmarkLock;
+#define BENCHMARK_THREAD_RESULT void*
+#define loadBenchmarkFlag(address) __atomic_load_n(address, __ATOMIC_SEQ_CST)
+#define storeBenchmarkFlag(address, value) __atomic_store_n(address, value, __ATOMIC_SEQ_CST)
+#endif
+
+#define BENCHMARK_ITEM_COUNT 1000
+#define BENCHMARK_KEY_COUNT 4
+#define BENCHMARK_SNAPSHOT_COUNT 200000
+
+inline static double getBenchmarkTime()
+{
+#if _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1000000000.0;
+#endif
+}
+inline static void sleepBenchmark()
+{
+#if _WIN32
+	Sleep(1);
+#else
+	struct timespec time = { 0, 1000000 };
+	nanosleep(&time, NULL);
+#endif
+}
+inline static size_t getBenchmarkCpuCount()
+{
+#if _WIN32
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	return (size_t)systemInfo.dwNumberOfProcessors;
+#else
+	long cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
+	return cpuCount > 0 ? (size_t)cpuCount : 1;
+#endif
+}
+
+inline static bool startBenchmarkThread(BenchmarkThread* thread,
+	BENCHMARK_THREAD_RESULT(*function)(void*), void* argument)
+{
+#if _WIN32
+	*thread = CreateThread(NULL, 0, function, argument, 0, NULL);
+	return *thread != NULL;
+#else
+	return pthread_create(thread, NULL, function, argument) == 0;
+#endif
+}
+inline static void joinBenchmarkThread(BenchmarkThread thread)
+{
+#if _WIN32
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+//**********************************************************************************************************************
+typedef struct BenchmarkContext
+{
+	char* data;
+	size_t dataSize;
+	ConfStore confStore;
+	ConfReader confReader;
+	BenchmarkLock lock;
+	volatile long isRunning;
+	volatile long isFailed;
+	bool useStore;
+} BenchmarkContext;
+
+inline static ConfReader createBenchmarkReader(const BenchmarkContext* context)
+{
+	ConfReader confReader;
+	if (createDataConfReaderN(context->data, context->dataSize, &confReader, NULL) != SUCCESS_CONF_RESULT)
+		return NULL;
+	if (buildConfReaderHashIndex(confReader, 0) != SUCCESS_CONF_RESULT)
+	{
+		destroyConfReader(confReader);
+		return NULL;
+	}
+	return confReader;
+}
+
+inline static int64_t readBenchmarkValues(ConfReader confReader, size_t offset)
+{
+	char key[32]; int64_t sum = 0, value;
+	for (size_t i = 0; i < BENCHMARK_KEY_COUNT; i++)
+	{
+		int keyLength = sprintf(key, "key.%llu", (long long unsigned int)((offset + i * 7) % BENCHMARK_ITEM_COUNT));
+		if (getConfReaderIntN(confReader, key, (size_t)keyLength, &value))
+			sum += value;
+	}
+	return sum;
+}
+
+static BENCHMARK_THREAD_RESULT readBenchmarkStore(void* argument)
+{
+	BenchmarkContext* context = (BenchmarkContext*)argument;
+	int64_t sum = 0;
+
+	if (context->useStore)
+	{
+		size_t readerIndex;
+		if (!registerConfStoreReader(context->confStore, &readerIndex))
+		{
+			storeBenchmarkFlag(&context->isFailed, 1);
+			return 0;
+		}
+
+		for (size_t i = 0; i < BENCHMARK_SNAPSHOT_COUNT; i++)
+		{
+			ConfReader snapshot = acquireConfStoreSnapshot(context->confStore, readerIndex);
+			sum += readBenchmarkValues(snapshot, i);
+			releaseConfStoreSnapshot(context->confStore, readerIndex);
+		}
+		unregisterConfStoreReader(context->confStore, readerIndex);
+	}
+	else
+	{
+		// Note: reference global reader / writer lock around the same lookups.
+		for (size_t i = 0; i < BENCHMARK_SNAPSHOT_COUNT; i++)
+		{
+			#if _WIN32
+			AcquireSRWLockShared(&context->lock);
+			sum += readBenchmarkValues(context->confReader, i);
+			ReleaseSRWLockShared(&context->lock);
+			#else
+			pthread_rwlock_rdlock(&context->lock);
+			sum += readBenchmarkValues(context->confReader, i);
+			pthread_rwlock_unlock(&context->lock);
+			#endif
+		}
+	}
+
+	if (sum <= 0)
+		storeBenchmarkFlag(&context->isFailed, 1);
+	return 0;
+}
+static BENCHMARK_THREAD_RESULT writeBenchmarkStore(void* argument)
+{
+	BenchmarkContext* context = (BenchmarkContext*)argument;
+	while (loadBenchmarkFlag(&context->isRunning))
+	{
+		ConfReader confReader = createBenchmarkReader(context);
+		if (!confReader)
+		{
+			storeBenchmarkFlag(&context->isFailed, 1);
+			return 0;
+		}
+
+		if (context->useStore)
+		{
+			if (publishConfStore(context->confStore, confReader) != SUCCESS_CONF_RESULT)
+			{
+				destroyConfReader(confReader);
+				storeBenchmarkFlag(&context->isFailed, 1);
+				return 0;
+			}
+		}
+		else
+		{
+			#if _WIN32
+			AcquireSRWLockExclusive(&context->lock);
+			ConfReader oldReader = context->confReader;
+			context->confReader = confReader;
+			ReleaseSRWLockExclusive(&context->lock);
+			#else
+			pthread_rwlock_wrlock(&context->lock);
+			ConfReader oldReader = context->confReader;
+			context->confReader = confReader;
+			pthread_rwlock_unlock(&context->lock);
+			#endif
+			destroyConfReader(oldReader);
+		}
+		sleepBenchmark();
+	}
+	return 0;
+}
+
+inline static double measureStoreLookups(BenchmarkContext* context, size_t threadCount)
+{
+	BenchmarkThread* threads = malloc(threadCount * sizeof(BenchmarkThread));
+	if (!threads)
+		return 0.0;
+
+	storeBenchmarkFlag(&context->isRunning, 1);
+	BenchmarkThread writerThread;
+	bool hasWriter = startBenchmarkThread(&writerThread, writeBenchmarkStore, context);
+
+	double startTime = getBenchmarkTime();
+	size_t startedCount = 0;
+	for (; startedCount < threadCount; startedCount++)
+	{
+		if (!startBenchmarkThread(&threads[startedCount], readBenchmarkStore, context))
+			break;
+	}
+	for (size_t i = 0; i < startedCount; i++)
+		joinBenchmarkThread(threads[i]);
+	double time = getBenchmarkTime() - startTime;
+
+	storeBenchmarkFlag(&context->isRunning, 0);
+	if (hasWriter)
+		joinBenchmarkThread(writerThread);
+	free(threads);
+
+	if (!hasWriter || startedCount != threadCount || loadBenchmarkFlag(&context->isFailed))
+		return 0.0;
+	return (double)(threadCount * BENCHMARK_SNAPSHOT_COUNT * BENCHMARK_KEY_COUNT) / time / 1000000.0;
+}
+
+inline static bool benchmarkStore(BenchmarkContext* context, size_t threadCount)
+{
+	ConfReader confReader = createBenchmarkReader(context);
+	if (!confReader)
+		return false;
+
+	context->useStore = true;
+	if (createConfStore(confReader, threadCount, &context->confStore) != SUCCESS_CONF_RESULT)
+	{
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	double storeRate = measureStoreLookups(context, threadCount);
+	destroyConfStore(context->confStore);
+
+	context->confReader = createBenchmarkReader(context);
+	if (!context->confReader)
+		return false;
+
+	#if _WIN32
+	InitializeSRWLock(&context->lock);
+	#else
+	pthread_rwlock_init(&context->lock, NULL);
+	#endif
+
+	context->useStore = false;
+	double lockRate = measureStoreLookups(context, threadCount);
+	destroyConfReader(context->confReader);
+
+	#if !_WIN32
+	pthread_rwlock_destroy(&context->lock);
+	#endif
+
+	printf("Store lookups: %llu threads, ConfStore %.1f M/s, reader / writer lock %.1f M/s\n",
+		(long long unsigned int)threadCount, storeRate, lockRate);
+	return storeRate > 0.0 && lockRate > 0.0;
+}
+
+//**********************************************************************************************************************
+int main(int argc, char* argv[])
+{
+	size_t maxThreadCount = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 0;
+	if (maxThreadCount == 0)
+		maxThreadCount = getBenchmarkCpuCount();
+
+	BenchmarkContext context;
+	memset(&context, 0, sizeof(BenchmarkContext));
+
+	context.data = malloc(BENCHMARK_ITEM_COUNT * 32 + 1);
+	if (!context.data)
+	{
+		printf("Failed to allocate benchmark data.\n");
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < BENCHMARK_ITEM_COUNT; i++)
+	{
+		context.dataSize += sprintf(context.data + context.dataSize, "key.%llu: %llu\n",
+			(long long unsigned int)i, (long long unsigned int)i + 1);
+	}
+
+	bool result = true;
+	for (size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+		result &= benchmarkStore(&context, threadCount);
+	free(context.data);
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
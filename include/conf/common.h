@@ -32,7 +32,10 @@ typedef enum ConfResult_T
 	BAD_VALUE_CONF_RESULT = 4,
 	BAD_ITEM_CONF_RESULT = 5,
 	REPEATING_KEYS_CONF_RESULT = 6,
-	CONF_RESULT_COUNT = 7,
+	BAD_IMAGE_CONF_RESULT = 7,
+	FAILED_TO_WRITE_FILE_CONF_RESULT = 8,
+	OWNED_DATA_CONF_RESULT = 9,
+	CONF_RESULT_COUNT = 10,
 } ConfResult_T;
 /**
  * @brief Conf result code type.
@@ -66,6 +69,9 @@ static const char* const confResultStrings[CONF_RESULT_COUNT] = {
 	"Bad value",
 	"Bad item",
 	"Repeating keys",
+	"Bad image",
+	"Failed to write file",
+	"Owned data",
 };
 
 /**
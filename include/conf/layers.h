@@ -0,0 +1,226 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf layered overlay lookups.
+ *
+ * @details
+ * Used to build the effective configuration from several sources, for example defaults, site file,
+ * environment variables and command line arguments. Each added layer overrides items of the previous ones.
+ * Layers are merged into one precomputed hash index when added, so each lookup is a single probe.
+ *
+ * Item with the "~" string value unsets the key in all previous layers. (APP_net__port=~ or --net.port=~)
+ * There is no escape for it, so a literal "~" string value can't be set by the layers.
+ *
+ * @code
+ * addConfLayersReader(confLayers, defaultsReader);
+ * addConfLayersReader(confLayers, fileReader);
+ * addConfLayersEnvironment(confLayers, NULL, "APP_", &errorLine);  // APP_net__port=80 -> net.port: 80
+ * addConfLayersArguments(confLayers, argc, argv, &errorLine);      // --net.port=8080 -> net.port: 8080
+ *
+ * getConfLayersInt(confLayers, "net.port", &port);                 // 8080
+ * @endcode
+ */
+
+#pragma once
+#include "conf/reader.h"
+
+/**
+ * @brief Conf layers structure.
+ */
+typedef struct ConfLayers_T ConfLayers_T;
+/**
+ * @brief Conf layers instance.
+ */
+typedef ConfLayers_T* ConfLayers;
+
+/**
+ * @brief Creates a new empty Conf layers instance.
+ *
+ * @param[out] confLayers pointer to the Conf layers instance
+ *
+ * @return The @ref ConfResult code and writes layers instance on success.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult createConfLayers(ConfLayers* confLayers);
+
+/**
+ * @brief Destroys Conf layers instance and all its readers.
+ * @param confLayers conf layers instance or NULL
+ */
+void destroyConfLayers(ConfLayers confLayers);
+
+/**
+ * @brief Adds a new top priority Conf reader layer.
+ * @details Layers take ownership of the reader on success. Merge is O(n + m) for n merged and m new items.
+ *
+ * @param confLayers conf layers instance
+ * @param confReader conf reader instance or section view
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult addConfLayersReader(ConfLayers confLayers, ConfReader confReader);
+
+/**
+ * @brief Adds a new top priority layer from the environment variables.
+ * @details Only variables starting with the prefix are read. Prefix is removed from the item key,
+ *          and each "__" is replaced with the ".". (APP_net__port=80 -> net.port: 80)
+ *          Values are parsed the same way as in the Conf file. Variables with empty value are skipped.
+ *
+ * @param confLayers conf layers instance
+ * @param[in] environment null terminated "NAME=value" string array, or NULL to read the process environment
+ * @param[in] prefix target variable name prefix string
+ * @param[out] errorLine pointer to the invalid variable number (index + 1) or NULL
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if variable has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if variable has invalid value
+ * @retval REPEATING_KEYS_CONF_RESULT if variables have duplicate keys
+ */
+ConfResult addConfLayersEnvironment(ConfLayers confLayers,
+	const char* const* environment, const char* prefix, size_t* errorLine);
+
+/**
+ * @brief Adds a new top priority layer from the command line arguments.
+ * @details Only "--key=value" arguments are read, others are skipped, as well as all arguments after the "--".
+ *          Values are parsed the same way as in the Conf file. Arguments with empty value are skipped.
+ *
+ * @param confLayers conf layers instance
+ * @param argumentCount command line argument count (argc)
+ * @param[in] arguments command line argument string array (argv)
+ * @param[out] errorLine pointer to the invalid argument number (index + 1) or NULL
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if argument has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if argument has invalid value
+ * @retval REPEATING_KEYS_CONF_RESULT if arguments have duplicate keys
+ */
+ConfResult addConfLayersArguments(ConfLayers confLayers,
+	int argumentCount, const char* const* arguments, size_t* errorLine);
+
+/***********************************************************************************************************************
+ * @brief Returns the Conf layers count.
+ * @param confLayers conf layers instance
+ */
+size_t getConfLayersCount(ConfLayers confLayers);
+
+/**
+ * @brief Returns the merged Conf layers item count.
+ * @details Count of the unique keys that are not unset.
+ * @param confLayers conf layers instance
+ */
+size_t getConfLayersItemCount(ConfLayers confLayers);
+
+/**
+ * @brief Returns the merged Conf layers item by index. (sorted by key)
+ * @details Use the reader getters with the item handle to get the value. (@ref getConfReaderIntAt())
+ *
+ * @param confLayers conf layers instance
+ * @param index target item index
+ * @param[out] key pointer to the item key string
+ * @param[out] keyLength pointer to the key string length or NULL
+ * @param[out] confReader pointer to the item layer reader
+ * @param[out] handle pointer to the item handle in the layer reader
+ */
+void getConfLayersItem(ConfLayers confLayers, size_t index, const char** key,
+	size_t* keyLength, ConfReader* confReader, size_t* handle);
+
+/**
+ * @brief Resolves item key to the top priority layer reader and item handle.
+ * @details Use the reader getters with the item handle to get the value. (@ref getConfReaderIntAt())
+ *
+ * @param confLayers conf layers instance
+ * @param[in] key target item key string
+ * @param keyLength key string length in characters
+ * @param[out] confReader pointer to the item layer reader
+ * @param[out] handle pointer to the item handle in the layer reader
+ *
+ * @return True on success, false if item is not found or unset.
+ */
+bool resolveConfLayersKey(ConfLayers confLayers, const char* key,
+	size_t keyLength, ConfReader* confReader, size_t* handle);
+
+/**
+ * @brief Returns the type of value by key.
+ * @details See the @ref getConfReaderType().
+ *
+ * @param confLayers conf layers instance
+ * @param[in] key target item key string
+ * @param[out] type pointer to the value type
+ *
+ * @return True on success, false if item is not found.
+ */
+bool getConfLayersType(ConfLayers confLayers, const char* key, ConfDataType* type);
+
+/**
+ * @brief Returns the integer value by key.
+ * @details See the @ref getConfReaderInt().
+ *
+ * @param confLayers conf layers instance
+ * @param[in] key target item key string
+ * @param[out] value pointer to the integer value
+ *
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfLayersInt(ConfLayers confLayers, const char* key, int64_t* value);
+
+/**
+ * @brief Returns the floating value by key.
+ * @details See the @ref getConfReaderFloat().
+ *
+ * @param confLayers conf layers instance
+ * @param[in] key target item key string
+ * @param[out] value pointer to the floating value
+ *
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfLayersFloat(ConfLayers confLayers, const char* key, double* value);
+
+/**
+ * @brief Returns the boolean value by key.
+ * @details See the @ref getConfReaderBool().
+ *
+ * @param confLayers conf layers instance
+ * @param[in] key target item key string
+ * @param[out] value pointer to the boolean value
+ *
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfLayersBool(ConfLayers confLayers, const char* key, bool* value);
+
+/**
+ * @brief Returns the string value by key.
+ * @details See the @ref getConfReaderString().
+ * @warning You should not free the returned string.
+ *
+ * @param confLayers conf layers instance
+ * @param[in] key target item key string
+ * @param[out] value pointer to the string value
+ * @param[out] length pointer to the string length or NULL
+ *
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfLayersString(ConfLayers confLayers, const char* key, const char** value, uint64_t* length);
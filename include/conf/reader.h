@@ -36,6 +36,119 @@ typedef struct ConfReader_T ConfReader_T;
  */
 typedef ConfReader_T* ConfReader;
 
+/**
+ * @brief Conf item change types.
+ */
+typedef enum ConfChange_T
+{
+	ADDED_CONF_CHANGE = 0,
+	REMOVED_CONF_CHANGE = 1,
+	CHANGED_CONF_CHANGE = 2,
+	RETYPED_CONF_CHANGE = 3,
+	CONF_CHANGE_COUNT = 4,
+} ConfChange_T;
+/**
+ * @brief Conf item change type.
+ */
+typedef uint8_t ConfChange;
+
+/**
+ * @brief Conf readers diff position.
+ * @details See the @ref nextConfReaderDiff().
+ */
+typedef struct ConfDiff
+{
+	size_t oldIndex;   /**< Old reader item index. (not valid if added) */
+	size_t newIndex;   /**< New reader item index. (not valid if removed) */
+	ConfChange change; /**< Item change type, or CONF_CHANGE_COUNT before the first call. */
+} ConfDiff;
+
+/**
+ * @brief Conf readers diff callback.
+ * @details See the @ref diffConfReaders().
+ *
+ * @param[in] key changed item key string (from the new reader, or from the old one if removed)
+ * @param keyLength key string length in characters
+ * @param[in] diff item change and indices
+ * @param[in,out] context user callback context or NULL
+ */
+typedef void(*OnConfDiff)(const char* key, size_t keyLength, const ConfDiff* diff, void* context);
+
+/**
+ * @brief Conf batch lookup request.
+ * @details See the @ref getConfReaderBatch().
+ */
+typedef struct ConfLookup
+{
+	const char* key;      /**< Target item key string. (can be not null terminated) */
+	size_t keyLength;     /**< Key string length in characters. */
+	ConfDataType type;    /**< Expected value type. */
+	void* value;          /**< Pointer to the int64_t, double, bool or const char* value. */
+	uint64_t* length;     /**< Pointer to the string length or NULL. */
+} ConfLookup;
+
+/**
+ * @brief Conf bound string field with length.
+ * @details See the @ref ConfBinding.
+ */
+typedef struct ConfBoundString
+{
+	const char* data; /**< String value. (not null terminated for the borrowed data reader) */
+	uint64_t length;  /**< String length in characters. */
+} ConfBoundString;
+
+/**
+ * @brief Conf struct field binding.
+ * @details See the @ref bindConfReaderStruct().
+ * 
+ * Supported field types: int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t 
+ * (with isUnsigned), float, double, bool, const char* and ConfBoundString. String field type is selected
+ * by the field size. Strings of the @ref createBorrowedDataConfReader() are not null terminated,
+ * so they are bound only to the ConfBoundString fields, and const char* fields are reported as mistyped.
+ * 
+ * Use designated initializers, omitted fields are zero (signed integer, no default value).
+ * 
+ * @code
+ * static const ConfBinding settingsBindings[] =
+ * {
+ *     { .key = "width", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(Settings, width),
+ *         .size = sizeof(int32_t), .defaultValue.integer = 1280 },
+ *     { .key = "port", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(Settings, port),
+ *         .size = sizeof(uint16_t), .defaultValue.integer = 80, .isUnsigned = true },
+ *     { .key = "title", .type = STRING_CONF_DATA_TYPE, .offset = offsetof(Settings, title),
+ *         .size = sizeof(const char*), .defaultValue.string = "Game" },
+ * };
+ * @endcode
+ */
+typedef struct ConfBinding
+{
+	const char* key;      /**< Target item key string. */
+	ConfDataType type;    /**< Field value type. */
+	size_t offset;        /**< Field offset in the struct. (offsetof) */
+	size_t size;          /**< Field size in bytes. (sizeof) */
+	union
+	{
+		int64_t integer;
+		double floating;
+		bool boolean;
+		const char* string;
+	} defaultValue;       /**< Value used if item is missing or mistyped. */
+	bool isUnsigned;      /**< Integer field is unsigned, negative values are mistyped. */
+} ConfBinding;
+
+/**
+ * @brief Conf reader memory usage in bytes.
+ * @details See the @ref getConfReaderMemoryUsage().
+ */
+typedef struct ConfMemoryUsage
+{
+	size_t items;     /**< Sorted item array size. */
+	size_t data;      /**< Key and string data size. (0 for the borrowed data reader) */
+	size_t hashIndex; /**< Hash table index size. (0 if not built) */
+	size_t sections;  /**< Section table and section view indices size. */
+	size_t mapped;    /**< Memory mapped image size. (contains items, data and stored hash index) */
+} ConfMemoryUsage;
+
 /**
  * @brief Creates a new Conf file reader instance.
  * @details The main function for reading Conf files.
@@ -53,10 +166,32 @@ typedef ConfReader_T* ConfReader;
  * @retval BAD_KEY_CONF_RESULT if config has invalid key
  * @retval BAD_VALUE_CONF_RESULT if config has invalid value
  * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
- * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, see the @ref createFileConfReaderEx())
  */
 ConfResult createFileConfReader(const char* filePath, ConfReader* confReader, size_t* errorLine);
 
+/**
+ * @brief Creates a new Conf file reader instance and reports both repeating key lines.
+ * @details See the @ref createFileConfReader().
+ * @note You should destroy created Conf instance manually.
+ *
+ * @param[in] filePath target Conf file path string
+ * @param[out] confReader pointer to the Conf reader instance
+ * @param[out] errorLine pointer to the error line or NULL
+ * @param[out] firstLine pointer to the first item line with the repeating key or NULL (0 on other errors)
+ * 
+ * @return The @ref ConfResult code and writes reader instance on success.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if file doesn't exist
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, and the first line)
+ */
+ConfResult createFileConfReaderEx(const char* filePath, ConfReader* confReader, size_t* errorLine, size_t* firstLine);
+
 /**
  * @brief Create a new Conf data reader instance.
  * @details The main function for reading Conf data from strings.
@@ -74,16 +209,318 @@ ConfResult createFileConfReader(const char* filePath, ConfReader* confReader, si
  * @retval BAD_KEY_CONF_RESULT if config has invalid key
  * @retval BAD_VALUE_CONF_RESULT if config has invalid value
  * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
- * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, see the @ref createDataConfReaderEx())
  */
 ConfResult createDataConfReader(const char* data, ConfReader* confReader, size_t* errorLine);
 
+/**
+ * @brief Create a new Conf data reader instance from a sized data buffer.
+ * @details Parses exactly size bytes, data buffer does not need to be null terminated.
+ * @note You should destroy created Conf instance manually.
+ *
+ * @param[in] data target Conf data buffer
+ * @param size data buffer size in bytes
+ * @param[out] confReader pointer to the Conf reader instance
+ * @param[out] errorLine pointer to the error line or NULL
+ * 
+ * @return The @ref ConfResult code and writes reader instance on success.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, see the @ref createDataConfReaderEx())
+ */
+ConfResult createDataConfReaderN(const char* data, size_t size, ConfReader* confReader, size_t* errorLine);
+
+/**
+ * @brief Create a new Conf data reader instance from a sized data buffer and reports both repeating key lines.
+ * @details See the @ref createDataConfReaderN().
+ * @note You should destroy created Conf instance manually.
+ *
+ * @param[in] data target Conf data buffer
+ * @param size data buffer size in bytes
+ * @param[out] confReader pointer to the Conf reader instance
+ * @param[out] errorLine pointer to the error line or NULL
+ * @param[out] firstLine pointer to the first item line with the repeating key or NULL (0 on other errors)
+ * 
+ * @return The @ref ConfResult code and writes reader instance on success.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, and the first line)
+ */
+ConfResult createDataConfReaderEx(const char* data, size_t size,
+	ConfReader* confReader, size_t* errorLine, size_t* firstLine);
+
+/**
+ * @brief Create a new Conf data reader instance which borrows the data buffer.
+ * @details Keys and string values are not copied, reader points to them inside the data buffer.
+ * @note You should destroy created Conf instance manually.
+ * @warning Data buffer should outlive the reader, and returned strings are not null terminated!
+ * Parses exactly size bytes, data buffer does not need to be null terminated.
+ * @note If config has [section] lines, keys and values are copied like in the @ref createDataConfReaderN(),
+ *       because section keys are stored with the "section." prefix. The reader is still created, but
+ *       OWNED_DATA_CONF_RESULT is returned. This costs a second parse of the lines before the first section
+ *       and the same memory as the owned reader.
+ *
+ * @param[in] data target Conf data buffer
+ * @param size data buffer size in bytes
+ * @param[out] confReader pointer to the Conf reader instance
+ * @param[out] errorLine pointer to the error line or NULL
+ * 
+ * @return The @ref ConfResult code and writes reader instance on success.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one)
+ * @retval OWNED_DATA_CONF_RESULT if config has sections, reader is created with the copied data
+ */
+ConfResult createBorrowedDataConfReader(const char* data, size_t size, ConfReader* confReader, size_t* errorLine);
+
+/**
+ * @brief Creates a new Conf reader instance from the compiled binary image file.
+ * @details Image file is memory mapped and used in place, no items are parsed or copied.
+ *          Header, sections, item and hash slot bounds are always checked. (O(n))
+ *          All reader getters work the same, string values are null terminated.
+ * @note Image is created with the @ref writeConfReaderImage(), text config stays the source of truth.
+ * @warning Image file should not be modified while the reader exists, replace it with a rename instead!
+ *          Without verification modified string and number values are not detected.
+ *
+ * @param[in] filePath target Conf image file path string
+ * @param verifyData also check the whole image checksum (O(size))
+ * @param[out] confReader pointer to the Conf reader instance
+ *
+ * @return The @ref ConfResult code and writes reader instance on success.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if failed to open or map file
+ * @retval BAD_IMAGE_CONF_RESULT if image is corrupted or built for a different platform
+ */
+ConfResult createImageConfReader(const char* filePath, bool verifyData, ConfReader* confReader);
+
+/**
+ * @brief Writes Conf reader items to the compiled binary image file.
+ * @details Image contains a header with the checksum, sorted items with typed values, the reader
+ *          hash index (if it was built), section table and a string pool. All references are offsets.
+ * @note Image uses the native byte order and value layout, rebuild it for each target platform.
+ *
+ * @param confReader conf reader instance (not a section view)
+ * @param[in] filePath target Conf image file path string
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if failed to open file
+ * @retval FAILED_TO_WRITE_FILE_CONF_RESULT if failed to write file
+ */
+ConfResult writeConfReaderImage(ConfReader confReader, const char* filePath);
+
 /**
  * @brief Destroys Conf reader instance.
  * @param confReader conf reader instance or NULL
  */
 void destroyConfReader(ConfReader confReader);
 
+/**
+ * @brief Returns true if Conf reader keys and string values point to the borrowed data buffer.
+ * @details False if reader owns its data, including the @ref createBorrowedDataConfReader() 
+ *          fallback for configs with [section] lines. Borrowed strings are not null terminated.
+ * @param confReader conf reader instance
+ */
+bool isConfReaderBorrowed(ConfReader confReader);
+
+/**
+ * @brief Conf parsed item value.
+ * @details See the @ref OnConfItem.
+ */
+typedef union ConfItemValue
+{
+	int64_t integer;
+	double floating;
+	bool boolean;
+	struct
+	{
+		const char* data; /**< String value, not null terminated. */
+		uint64_t length;  /**< String length in characters. */
+	} string;
+} ConfItemValue;
+
+/**
+ * @brief Conf parsed item callback.
+ * @details See the @ref parseConfData().
+ * @warning Key and value pointers are valid only during the callback call!
+ * 
+ * @param[in] key item key string, not null terminated (with a "section." prefix)
+ * @param keyLength key string length in characters
+ * @param type item value type
+ * @param[in] value pointer to the item value
+ * @param line item line number in the config
+ * @param[in,out] context user callback context or NULL
+ */
+typedef void(*OnConfItem)(const char* key, size_t keyLength, ConfDataType type,
+	const ConfItemValue* value, size_t line, void* context);
+
+/**
+ * @brief Conf incremental parser structure.
+ */
+typedef struct ConfParser_T ConfParser_T;
+/**
+ * @brief Conf incremental parser instance.
+ * @details See the @ref feedConfParser().
+ */
+typedef ConfParser_T* ConfParser;
+
+/**
+ * @brief Creates a new push-based Conf parser instance.
+ * @details Parses config data chunks as they arrive, for example from a socket or a compressed stream.
+ * @param[out] confParser pointer to the Conf parser instance
+ *
+ * @return The @ref ConfResult code and writes parser instance on success.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult createConfParser(ConfParser* confParser);
+
+/**
+ * @brief Destroys Conf parser instance.
+ * @param confParser conf parser instance or NULL
+ */
+void destroyConfParser(ConfParser confParser);
+
+/**
+ * @brief Parses the next Conf data chunk.
+ * @details Chunks can split lines at any byte, the unfinished line is kept until the next chunk.
+ * @note Buffered data is bounded by the longest line, parsed keys and values are copied.
+ * 
+ * @param confParser conf parser instance
+ * @param[in] data target Conf data chunk
+ * @param size data chunk size in bytes
+ * @param[out] errorLine pointer to the error line or NULL
+ * 
+ * @return The @ref ConfResult code. Error is also returned by the next feed and finish calls.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ */
+ConfResult feedConfParser(ConfParser confParser, const char* data, size_t size, size_t* errorLine);
+
+/**
+ * @brief Parses the last unfinished line and creates a new Conf reader instance.
+ * @details Parser is reset after this call and can be reused for the next config.
+ * 
+ * @param confParser conf parser instance
+ * @param[out] confReader pointer to the Conf reader instance
+ * @param[out] errorLine pointer to the error line or NULL
+ * 
+ * @return The @ref ConfResult code and writes reader instance on success.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one)
+ */
+ConfResult finishConfParser(ConfParser confParser, ConfReader* confReader, size_t* errorLine);
+
+/**
+ * @brief Parses Conf data and calls the callback for each item, without creating a reader.
+ * @details Intended for one-shot loads, items are not copied, sorted or indexed.
+ *          Items are reported in the config line order.
+ * 
+ * @param[in] data target Conf data buffer
+ * @param size data buffer size in bytes
+ * @param onItem item callback function
+ * @param[in,out] context user callback context or NULL
+ * @param checkRepeats track item keys and fail on duplicates
+ * @param[out] errorLine pointer to the error line or NULL
+ * 
+ * @return The @ref ConfResult code. Items before the error line are already reported.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (only with checkRepeats)
+ */
+ConfResult parseConfData(const char* data, size_t size, OnConfItem onItem,
+	void* context, bool checkRepeats, size_t* errorLine);
+
+/**
+ * @brief Parses Conf file and calls the callback for each item, without creating a reader.
+ * @details See the @ref parseConfData().
+ * 
+ * @param[in] filePath target Conf file path string
+ * @param onItem item callback function
+ * @param[in,out] context user callback context or NULL
+ * @param checkRepeats track item keys and fail on duplicates
+ * @param[out] errorLine pointer to the error line or NULL
+ * 
+ * @return The @ref ConfResult code.
+ * 
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if failed to open file
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (only with checkRepeats)
+ */
+ConfResult parseConfFile(const char* filePath, OnConfItem onItem,
+	void* context, bool checkRepeats, size_t* errorLine);
+
+/**
+ * @brief Returns the Conf item key hash. (SipHash-1-3)
+ * @details Same hash function is used by the reader hash index.
+ *
+ * @param[in] key target item key string
+ * @param keySize key string length in characters
+ * @param seed hash function seed
+ *
+ * @return The 64-bit key hash value.
+ */
+uint64_t hashConfKey(const char* key, size_t keySize, uint64_t seed);
+
+/**
+ * @brief Builds a hash table index for the Conf reader key lookups.
+ * @details Replaces binary search in all getters with an open addressing hash table lookup.
+ * @note Use a random seed if config comes from an untrusted source, to prevent hash flooding.
+ *
+ * @param confReader conf reader instance
+ * @param seed key hash function seed
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult buildConfReaderHashIndex(ConfReader confReader, uint64_t seed);
+
+/**
+ * @brief Returns the Conf reader memory usage.
+ * @details Reports the reader allocation, not the process memory. For the image reader
+ *          items, data and stored hash index are located inside the mapped image.
+ *
+ * @param confReader conf reader instance
+ * @param[out] memoryUsage pointer to the memory usage
+ */
+void getConfReaderMemoryUsage(ConfReader confReader, ConfMemoryUsage* memoryUsage);
+
 /***********************************************************************************************************************
  * @brief Returns the type of value by key.
  * @details Useful if we are reading a config we don't know anything about.
@@ -132,6 +569,7 @@ bool getConfReaderBool(ConfReader confReader, const char* key, bool* value);
 /**
  * @brief Returns the string value by key.
  * @warning Yous should not free the returned string.
+ * @note String is not null terminated if reader was created with @ref createBorrowedDataConfReader().
  *
  * @param confReader conf reader instance
  * @param[in] key target item key string
@@ -140,4 +578,284 @@ bool getConfReaderBool(ConfReader confReader, const char* key, bool* value);
  * 
  * @return True on success, false if item is not found or has a different type.
  */
-bool getConfReaderString(ConfReader confReader, const char* key, const char** value, uint64_t* length);
\ No newline at end of file
+bool getConfReaderString(ConfReader confReader, const char* key, const char** value, uint64_t* length);
+
+/***********************************************************************************************************************
+ * @brief Resolves item key to a handle for the fast value access.
+ * @details Handle is an index of the item, it stays valid until the reader is destroyed.
+ * 
+ * @param confReader conf reader instance
+ * @param[in] key target item key string
+ * @param keyLength key string length in characters
+ * @param[out] handle pointer to the item handle
+ * 
+ * @return True on success, false if item is not found.
+ */
+bool resolveConfReaderKey(ConfReader confReader, const char* key, size_t keyLength, size_t* handle);
+
+/**
+ * @brief Resolves item key to a handle using precomputed key hash.
+ * @details Skips key hashing if reader hash index was built with the same seed, otherwise ignores the hash.
+ * 
+ * @param confReader conf reader instance
+ * @param[in] key target item key string
+ * @param keyLength key string length in characters
+ * @param hash key hash value computed with the @ref hashConfKey()
+ * @param hashSeed seed used to compute the key hash
+ * @param[out] handle pointer to the item handle
+ * 
+ * @return True on success, false if item is not found.
+ */
+bool resolveConfReaderHashedKey(ConfReader confReader, const char* key,
+	size_t keyLength, uint64_t hash, uint64_t hashSeed, size_t* handle);
+
+/***********************************************************************************************************************
+ * @brief Returns the type of value by key with explicit length.
+ * @details See the @ref getConfReaderType().
+ * 
+ * @param confReader conf reader instance
+ * @param[in] key target item key string (can be not null terminated)
+ * @param keyLength key string length in characters
+ * @param[out] type pointer to the value type
+ * 
+ * @return True on success, false if item is not found.
+ */
+bool getConfReaderTypeN(ConfReader confReader, const char* key, size_t keyLength, ConfDataType* type);
+/**
+ * @brief Returns the integer value by key with explicit length.
+ * @details See the @ref getConfReaderInt().
+ *
+ * @param confReader conf reader instance
+ * @param[in] key target item key string (can be not null terminated)
+ * @param keyLength key string length in characters
+ * @param[out] value pointer to the integer value
+ * 
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfReaderIntN(ConfReader confReader, const char* key, size_t keyLength, int64_t* value);
+/**
+ * @brief Returns the floating value by key with explicit length.
+ * @details See the @ref getConfReaderFloat().
+ *
+ * @param confReader conf reader instance
+ * @param[in] key target item key string (can be not null terminated)
+ * @param keyLength key string length in characters
+ * @param[out] value pointer to the floating value
+ * 
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfReaderFloatN(ConfReader confReader, const char* key, size_t keyLength, double* value);
+/**
+ * @brief Returns the boolean value by key with explicit length.
+ * @details See the @ref getConfReaderBool().
+ *
+ * @param confReader conf reader instance
+ * @param[in] key target item key string (can be not null terminated)
+ * @param keyLength key string length in characters
+ * @param[out] value pointer to the boolean value
+ * 
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfReaderBoolN(ConfReader confReader, const char* key, size_t keyLength, bool* value);
+/**
+ * @brief Returns the string value by key with explicit length.
+ * @details See the @ref getConfReaderString().
+ *
+ * @param confReader conf reader instance
+ * @param[in] key target item key string (can be not null terminated)
+ * @param keyLength key string length in characters
+ * @param[out] value pointer to the string value
+ * @param[out] length pointer to the string length or NULL
+ * 
+ * @return True on success, false if item is not found or has a different type.
+ */
+bool getConfReaderStringN(ConfReader confReader, const char* key,
+	size_t keyLength, const char** value, uint64_t* length);
+
+/***********************************************************************************************************************
+ * @brief Returns the config section view.
+ * @details
+ * Items after the "[name]" line are stored with the "name." key prefix, so "[net]" and "port: 80" 
+ * is the same as "net.port: 80". Section view lookups search only the section items, without the prefix.
+ * Section keys take the same reader memory as the dotted keys, sections make only the config file shorter.
+ * @note View is valid until the reader is destroyed, destroying the view itself does nothing.
+ * 
+ * @param confReader conf reader instance
+ * @param[in] name target section name string
+ * @param[out] section pointer to the section reader view
+ * 
+ * @return True on success, false if section is not found.
+ */
+bool getConfReaderSection(ConfReader confReader, const char* name, ConfReader* section);
+/**
+ * @brief Returns the config section view by name with explicit length.
+ * @details See the @ref getConfReaderSection().
+ * 
+ * @param confReader conf reader instance
+ * @param[in] name target section name string (can be not null terminated)
+ * @param nameLength section name string length in characters
+ * @param[out] section pointer to the section reader view
+ * 
+ * @return True on success, false if section is not found.
+ */
+bool getConfReaderSectionN(ConfReader confReader, const char* name, size_t nameLength, ConfReader* section);
+
+/**
+ * @brief Finds the range of items whose keys start with the prefix.
+ * @details Items are sorted lexicographically, so all matching keys are stored next to each other.
+ *          For example "render." prefix returns "render.height", "render.width", etc. in O(log n).
+ * 
+ * @param confReader conf reader instance
+ * @param[in] prefix target key prefix string (can be not null terminated)
+ * @param prefixLength prefix string length in characters
+ * @param[out] first pointer to the first matching item index
+ * @param[out] count pointer to the matching item count
+ * 
+ * @return True if at least one item is found, otherwise false.
+ */
+bool findConfReaderPrefix(ConfReader confReader, const char* prefix, size_t prefixLength, size_t* first, size_t* count);
+
+/**
+ * @brief Returns the Conf reader item count.
+ * @details Items are indexed from 0 to count - 1, item index is the same as the item handle.
+ * @param confReader conf reader instance
+ */
+size_t getConfReaderItemCount(ConfReader confReader);
+
+/**
+ * @brief Returns the Conf reader item key and type by index.
+ * @details Items are sorted by key in lexicographic (byte) order. Use the getConfReaderIntAt(), getConfReaderStringAt(), etc. to get the value.
+ * @note Earlier versions sorted shorter keys first, iteration order has changed. (see the README breaking changes)
+ * @warning Yous should not free the returned key string.
+ * @note Key is not null terminated if reader was created with @ref createBorrowedDataConfReader().
+ * 
+ * @param confReader conf reader instance
+ * @param index target item index
+ * @param[out] key pointer to the item key string
+ * @param[out] keyLength pointer to the key string length or NULL
+ * @param[out] type pointer to the value type or NULL
+ * 
+ * @return True on success, false if index is out of range.
+ */
+bool getConfReaderItem(ConfReader confReader, size_t index, const char** key, size_t* keyLength, ConfDataType* type);
+
+/**
+ * @brief Returns the type of value by item handle.
+ * @details Handle is returned by the @ref resolveConfReaderKey() or it's an item index.
+ * 
+ * @param confReader conf reader instance
+ * @param handle target item handle
+ * 
+ * @return The item value type, or CONF_DATA_TYPE_COUNT if handle is out of range.
+ */
+ConfDataType getConfReaderTypeAt(ConfReader confReader, size_t handle);
+/**
+ * @brief Returns the integer value by item handle.
+ *
+ * @param confReader conf reader instance
+ * @param handle target item handle
+ * @param[out] value pointer to the integer value
+ * 
+ * @return True on success, false if item has a different type or handle is out of range.
+ */
+bool getConfReaderIntAt(ConfReader confReader, size_t handle, int64_t* value);
+/**
+ * @brief Returns the floating value by item handle.
+ *
+ * @param confReader conf reader instance
+ * @param handle target item handle
+ * @param[out] value pointer to the floating value
+ * 
+ * @return True on success, false if item has a different type or handle is out of range.
+ */
+bool getConfReaderFloatAt(ConfReader confReader, size_t handle, double* value);
+/**
+ * @brief Returns the boolean value by item handle.
+ *
+ * @param confReader conf reader instance
+ * @param handle target item handle
+ * @param[out] value pointer to the boolean value
+ * 
+ * @return True on success, false if item has a different type or handle is out of range.
+ */
+bool getConfReaderBoolAt(ConfReader confReader, size_t handle, bool* value);
+/**
+ * @brief Returns the string value by item handle.
+ * @warning Yous should not free the returned string.
+ *
+ * @param confReader conf reader instance
+ * @param handle target item handle
+ * @param[out] value pointer to the string value
+ * @param[out] length pointer to the string length or NULL
+ * 
+ * @return True on success, false if item has a different type or handle is out of range.
+ */
+bool getConfReaderStringAt(ConfReader confReader, size_t handle, const char** value, uint64_t* length);
+
+/***********************************************************************************************************************
+ * @brief Returns multiple values by keys in one pass.
+ * @details
+ * Faster than separate getter calls for the large key sets, requested keys are sorted and 
+ * merged against the sorted reader items. (or looked up in the hash index if it's built)
+ * Batches of up to 64 keys are sorted without allocation, already sorted batches are not sorted again.
+ * Values are converted the same way as in the getConfReaderInt(), getConfReaderFloat(), etc.
+ * 
+ * @param confReader conf reader instance
+ * @param[in] lookups array of the lookup requests
+ * @param lookupCount number of the lookup requests
+ * @param[out] statusBits array of the (lookupCount + 63) / 64 status words or NULL
+ * 
+ * @return The number of found values. Sets bit i of the statusBits[i / 64] if lookup i is found.
+ */
+size_t getConfReaderBatch(ConfReader confReader, const ConfLookup* lookups, size_t lookupCount, uint64_t* statusBits);
+
+/**
+ * @brief Fills struct fields with values described by the binding table.
+ * @details
+ * Resolves all keys in one merge pass, like the @ref getConfReaderBatch().
+ * Missing and mistyped fields (including out of range integers) are set to the default value.
+ * @warning Bound strings are valid until the reader is destroyed. (or the borrowed data buffer)
+ * 
+ * @param confReader conf reader instance
+ * @param[in] bindings array of the struct field bindings
+ * @param bindingCount number of the struct field bindings
+ * @param[out] target pointer to the target struct
+ * @param[out] missingBits array of the (bindingCount + 63) / 64 missing key bit words or NULL
+ * @param[out] mistypedBits array of the (bindingCount + 63) / 64 mistyped key bit words or NULL
+ * 
+ * @return The number of fields set from the config items.
+ */
+size_t bindConfReaderStruct(ConfReader confReader, const ConfBinding* bindings,
+	size_t bindingCount, void* target, uint64_t* missingBits, uint64_t* mistypedBits);
+
+/***********************************************************************************************************************
+ * @brief Finds the next different item between two Conf readers.
+ * @details Walks both sorted item arrays in one merge pass, O(n + m) in total and without allocations.
+ *          Values are compared only if item types are the same, floating values are compared bitwise.
+ * 
+ * @code
+ * ConfDiff diff = { 0, 0, CONF_CHANGE_COUNT };
+ * while (nextConfReaderDiff(oldReader, newReader, &diff))
+ *     printf("%d\n", (int)diff.change);
+ * @endcode
+ *
+ * @param oldReader old conf reader instance
+ * @param newReader new conf reader instance
+ * @param[in,out] diff pointer to the diff position
+ *
+ * @return True if a different item is found, false if there are no more differences.
+ */
+bool nextConfReaderDiff(ConfReader oldReader, ConfReader newReader, ConfDiff* diff);
+
+/**
+ * @brief Calls the callback for each added, removed, retyped or changed item between two Conf readers.
+ * @details See the @ref nextConfReaderDiff().
+ *
+ * @param oldReader old conf reader instance
+ * @param newReader new conf reader instance
+ * @param onDiff item diff callback function
+ * @param[in,out] context user callback context or NULL
+ *
+ * @return The number of different items.
+ */
+size_t diffConfReaders(ConfReader oldReader, ConfReader newReader, OnConfDiff onDiff, void* context);
@@ -0,0 +1,132 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf concurrent reader store.
+ *
+ * @details
+ * Used to share Conf reader snapshots between many threads and swap them while they are read.
+ * Snapshots are published through an atomic pointer, old ones are destroyed with the epoch-based reclamation
+ * after all threads that could see them have released them. Reader threads never wait and never take locks.
+ *
+ * @code
+ * size_t readerIndex;
+ * registerConfStoreReader(confStore, &readerIndex);  // Once per thread.
+ *
+ * ConfReader snapshot = acquireConfStoreSnapshot(confStore, readerIndex);
+ * getConfReaderInt(snapshot, "width", &width);       // Both values are from the same version.
+ * getConfReaderInt(snapshot, "height", &height);
+ * releaseConfStoreSnapshot(confStore, readerIndex);
+ * @endcode
+ */
+
+#pragma once
+#include "conf/reader.h"
+
+/**
+ * @brief Conf store structure.
+ */
+typedef struct ConfStore_T ConfStore_T;
+/**
+ * @brief Conf store instance.
+ */
+typedef ConfStore_T* ConfStore;
+
+/**
+ * @brief Creates a new Conf concurrent reader store instance.
+ * @details Store takes ownership of the reader.
+ *
+ * @param confReader initial conf reader instance
+ * @param maxReaderCount maximum registered reader thread count
+ * @param[out] confStore pointer to the Conf store instance
+ *
+ * @return The @ref ConfResult code and writes store instance on success.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult createConfStore(ConfReader confReader, size_t maxReaderCount, ConfStore* confStore);
+
+/**
+ * @brief Destroys Conf store instance and all its readers.
+ * @warning There should be no acquired snapshots!
+ * @param confStore conf store instance or NULL
+ */
+void destroyConfStore(ConfStore confStore);
+
+/**
+ * @brief Registers a new reader thread in the Conf store.
+ * @details Thread safe. Each thread should use its own reader index.
+ *
+ * @param confStore conf store instance
+ * @param[out] readerIndex pointer to the reader index
+ *
+ * @return True on success, false if all reader slots are used.
+ */
+bool registerConfStoreReader(ConfStore confStore, size_t* readerIndex);
+
+/**
+ * @brief Unregisters reader thread from the Conf store.
+ * @details Thread safe. Snapshot should be released before this call.
+ *
+ * @param confStore conf store instance
+ * @param readerIndex registered reader index
+ */
+void unregisterConfStoreReader(ConfStore confStore, size_t readerIndex);
+
+/**
+ * @brief Acquires the current Conf reader snapshot. (wait-free)
+ * @details Snapshot is immutable and stays valid until the @ref releaseConfStoreSnapshot() call.
+ *          Use it to read several values from the same config version.
+ * @warning Do not destroy the returned reader or build its hash index!
+ *
+ * @param confStore conf store instance
+ * @param readerIndex registered reader index
+ *
+ * @return The current Conf reader snapshot instance.
+ */
+ConfReader acquireConfStoreSnapshot(ConfStore confStore, size_t readerIndex);
+
+/**
+ * @brief Releases the acquired Conf reader snapshot. (wait-free)
+ *
+ * @param confStore conf store instance
+ * @param readerIndex registered reader index
+ */
+void releaseConfStoreSnapshot(ConfStore confStore, size_t readerIndex);
+
+/**
+ * @brief Publishes a new Conf reader snapshot.
+ * @details Thread safe. Store takes ownership of the reader on success. Previous snapshot is destroyed
+ *          once no thread can see it, build the reader hash index before publishing it if needed.
+ *
+ * @param confStore conf store instance
+ * @param confReader new conf reader instance
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory (reader is not published)
+ */
+ConfResult publishConfStore(ConfStore confStore, ConfReader confReader);
+
+/**
+ * @brief Destroys retired Conf reader snapshots that are no longer visible to any thread.
+ * @details Thread safe. Also called by the @ref publishConfStore().
+ *
+ * @param confStore conf store instance
+ * @return The remaining retired snapshot count.
+ */
+size_t reclaimConfStore(ConfStore confStore);
@@ -0,0 +1,165 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf file watcher. (hot reload)
+ *
+ * @details
+ * Used to reload Conf files without restarting the application. It watches the file for changes
+ * (inotify on Linux, file time and size polling on other systems), re-parses it and calls change
+ * callbacks only for items that were added, removed, retyped or changed.
+ *
+ * Watcher is not thread safe, its reader is replaced and destroyed by the reload. To read the config from
+ * other threads, attach a @ref ConfStore with the @ref createConfWatcherStore(), reloaded readers are
+ * then published to it atomically and destroyed only after all threads have released them.
+ */
+
+#pragma once
+#include "conf/store.h"
+
+/**
+ * @brief Conf item change callback.
+ * @details See the @ref addConfWatcherCallback().
+ * @note Old reader is destroyed after all callbacks are called. (or after all store snapshots are released)
+ *
+ * @param[in] key changed item key string (from the new reader, or from the old one if removed)
+ * @param keyLength key string length in characters
+ * @param change item change type
+ * @param oldReader previous conf reader instance
+ * @param newReader current conf reader instance
+ * @param[in,out] context user callback context or NULL
+ */
+typedef void(*OnConfChange)(const char* key, size_t keyLength, ConfChange change,
+	ConfReader oldReader, ConfReader newReader, void* context);
+
+/**
+ * @brief Conf watcher structure.
+ */
+typedef struct ConfWatcher_T ConfWatcher_T;
+/**
+ * @brief Conf watcher instance.
+ */
+typedef ConfWatcher_T* ConfWatcher;
+
+/**
+ * @brief Creates a new Conf file watcher instance and reads the file.
+ * @details See the @ref createFileConfReader().
+ *
+ * @param[in] filePath target Conf file path string
+ * @param[out] confWatcher pointer to the Conf watcher instance
+ * @param[out] errorLine pointer to the error line or NULL
+ *
+ * @return The @ref ConfResult code and writes watcher instance on success.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if failed to open file
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, see the @ref createFileConfReaderEx())
+ */
+ConfResult createConfWatcher(const char* filePath, ConfWatcher* confWatcher, size_t* errorLine);
+
+/**
+ * @brief Destroys Conf watcher instance and its current reader. (if there is no attached store)
+ * @param confWatcher conf watcher instance or NULL
+ */
+void destroyConfWatcher(ConfWatcher confWatcher);
+
+/**
+ * @brief Creates a new Conf store fed by the watcher.
+ * @details Store takes ownership of the current watcher reader, and each reloaded reader is published to it
+ *          with the @ref publishConfStore(). Watcher keeps one extra store reader slot to pin the old reader
+ *          while change callbacks are called. Other threads should read the config only through the store.
+ * @warning Destroy the watcher before the store, and do not publish to the store directly!
+ *
+ * @param confWatcher conf watcher instance (without a store)
+ * @param maxReaderCount maximum registered reader thread count
+ * @param[out] confStore pointer to the Conf store instance
+ *
+ * @return The @ref ConfResult code and writes store instance on success.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult createConfWatcherStore(ConfWatcher confWatcher, size_t maxReaderCount, ConfStore* confStore);
+
+/**
+ * @brief Returns the current Conf watcher reader instance.
+ * @warning Returned reader is destroyed on the next successful reload! Use it only on the thread which calls 
+ *          the watcher update and reload, other threads should use the @ref createConfWatcherStore().
+ * @param confWatcher conf watcher instance
+ */
+ConfReader getConfWatcherReader(ConfWatcher confWatcher);
+
+/**
+ * @brief Adds a new Conf item change callback.
+ * @details Callback is called for each changed item with the key starting with the prefix.
+ *          Use an empty prefix for all items, or "section." for all section items.
+ *
+ * @param confWatcher conf watcher instance
+ * @param[in] prefix target item key prefix string
+ * @param onChange item change callback function
+ * @param[in,out] context user callback context or NULL
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ */
+ConfResult addConfWatcherCallback(ConfWatcher confWatcher, const char* prefix, OnConfChange onChange, void* context);
+
+/**
+ * @brief Reloads Conf watcher file if it was changed since the last update.
+ * @details Non-blocking, call it periodically. (for example, once per frame or second)
+ *          Current reader stays unchanged if the new file content is invalid.
+ *          Failed reload stays pending and is retried on each update, until the file is valid again.
+ *
+ * @param confWatcher conf watcher instance
+ * @param[out] isReloaded pointer to the reload flag or NULL
+ * @param[out] errorLine pointer to the error line or NULL
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success, or if file is not changed
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if failed to open file
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, see the @ref createFileConfReaderEx())
+ */
+ConfResult updateConfWatcher(ConfWatcher confWatcher, bool* isReloaded, size_t* errorLine);
+
+/**
+ * @brief Reloads Conf watcher file and calls change callbacks.
+ * @details Current reader stays unchanged if the new file content is invalid. (reload stays pending)
+ *          New reader is published to the attached store before the callbacks are called.
+ *
+ * @param confWatcher conf watcher instance
+ * @param[out] errorLine pointer to the error line or NULL
+ *
+ * @return The @ref ConfResult code.
+ *
+ * @retval SUCCESS_CONF_RESULT on success
+ * @retval FAILED_TO_ALLOCATE_CONF_RESULT if out of memory
+ * @retval FAILED_TO_OPEN_FILE_CONF_RESULT if failed to open file
+ * @retval BAD_KEY_CONF_RESULT if config has invalid key
+ * @retval BAD_VALUE_CONF_RESULT if config has invalid value
+ * @retval BAD_ITEM_CONF_RESULT if config has invalid key / value pair
+ * @retval REPEATING_KEYS_CONF_RESULT if config has duplicate keys (error line of the repeated one, see the @ref createFileConfReaderEx())
+ */
+ConfResult reloadConfWatcher(ConfWatcher confWatcher, size_t* errorLine);
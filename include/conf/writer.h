@@ -73,6 +73,17 @@ bool writeConfComment(ConfWriter confWriter, const char* comment);
  */
 bool writeConfNewLine(ConfWriter confWriter);
 
+/**
+ * @brief Writes a section header to the config. ("[name]")
+ * @details Items written after it belong to the section, see the @ref getConfReaderSection().
+ *
+ * @param confWriter conf writer instance
+ * @param[in] name target section name string
+ * 
+ * @return True on success, otherwise false.
+ */
+bool writeConfSection(ConfWriter confWriter, const char* name);
+
 /**
  * @brief Writes an integer value to the config.
  *
@@ -86,11 +97,12 @@ bool writeConfInt(ConfWriter confWriter, const char* key, int64_t value);
 
 /**
  * @brief Writes a floating value to the config.
+ * @details With 0 precision writes the shortest value representation which is read back unchanged.
  *
  * @param confWriter conf writer instance
  * @param[in] key target item key string
  * @param value floating item value
- * @param precision number of digits after the decimal point, or 0 (auto detect)
+ * @param precision maximum number of digits after the decimal point, or 0 (exact round trip)
  * 
  * @return True on success, otherwise false.
  */
@@ -0,0 +1,511 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/layers.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+#if _WIN32
+#define confEnvironment ((const char* const*)_environ)
+#elif __APPLE__
+#include <crt_externs.h>
+#define confEnvironment ((const char* const*)*_NSGetEnviron())
+#else
+extern char** environ;
+#define confEnvironment ((const char* const*)environ)
+#endif
+
+typedef struct ConfLayerItem
+{
+	const char* key;
+	size_t keyLength;
+	ConfReader reader;
+	size_t handle;
+} ConfLayerItem;
+
+typedef struct ConfLayerSlot
+{
+	uint32_t hash;
+	uint32_t index;
+} ConfLayerSlot;
+
+struct ConfLayers_T
+{
+	ConfReader* readers;
+	ConfLayerItem* items;
+	ConfLayerSlot* slots;
+	size_t readerCount;
+	size_t readerCapacity;
+	size_t itemCount;
+	size_t hashMask;
+};
+
+//**********************************************************************************************************************
+inline static int compareConfLayerKeys(const char* keyA, size_t keySizeA, const char* keyB, size_t keySizeB)
+{
+	// Note: same order as the reader items, so layers are merged without sorting.
+	int result = memcmp(keyA, keyB, (keySizeA < keySizeB ? keySizeA : keySizeB) * sizeof(char));
+	if (result != 0)
+		return result;
+	if (keySizeA != keySizeB)
+		return keySizeA < keySizeB ? -1 : 1;
+	return 0;
+}
+inline static bool isConfLayerItemUnset(ConfReader confReader, size_t handle)
+{
+	const char* value; uint64_t length;
+	return getConfReaderStringAt(confReader, handle, &value, &length) && length == 1 && value[0] == '~';
+}
+
+inline static ConfResult buildConfLayerSlots(const ConfLayerItem* items,
+	size_t itemCount, ConfLayerSlot** slots, size_t* hashMask)
+{
+	if (itemCount >= UINT32_MAX || itemCount > SIZE_MAX / (sizeof(ConfLayerSlot) * 4))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	// Note: keeping load factor at or below 0.5 for short linear probes.
+	size_t slotCount = 2;
+	while (slotCount < itemCount * 2)
+		slotCount *= 2;
+
+	ConfLayerSlot* layerSlots = calloc(slotCount, sizeof(ConfLayerSlot));
+	if (!layerSlots)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	size_t mask = slotCount - 1;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		uint64_t hash = hashConfKey(items[i].key, items[i].keyLength, 0);
+		size_t slot = (size_t)hash & mask;
+		while (layerSlots[slot].index != 0)
+			slot = (slot + 1) & mask;
+
+		layerSlots[slot].hash = (uint32_t)(hash >> 32);
+		layerSlots[slot].index = (uint32_t)(i + 1);
+	}
+
+	*slots = layerSlots;
+	*hashMask = mask;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+ConfResult createConfLayers(ConfLayers* confLayers)
+{
+	assert(confLayers != NULL);
+
+	ConfLayers confLayersInstance = calloc(1, sizeof(ConfLayers_T));
+	if (!confLayersInstance)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	*confLayers = confLayersInstance;
+	return SUCCESS_CONF_RESULT;
+}
+void destroyConfLayers(ConfLayers confLayers)
+{
+	if (!confLayers)
+		return;
+
+	for (size_t i = 0; i < confLayers->readerCount; i++)
+		destroyConfReader(confLayers->readers[i]);
+	free(confLayers->readers);
+	free(confLayers->slots);
+	free(confLayers->items);
+	free(confLayers);
+}
+
+//**********************************************************************************************************************
+ConfResult addConfLayersReader(ConfLayers confLayers, ConfReader confReader)
+{
+	assert(confLayers != NULL);
+	assert(confReader != NULL);
+
+	if (confLayers->readerCount == confLayers->readerCapacity)
+	{
+		size_t readerCapacity = confLayers->readerCapacity > 0 ? confLayers->readerCapacity * 2 : 4;
+		ConfReader* readers = realloc(confLayers->readers, readerCapacity * sizeof(ConfReader));
+		if (!readers)
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+		confLayers->readers = readers;
+		confLayers->readerCapacity = readerCapacity;
+	}
+
+	const ConfLayerItem* oldItems = confLayers->items;
+	size_t oldCount = confLayers->itemCount, newCount = getConfReaderItemCount(confReader);
+	if (oldCount + newCount < oldCount || oldCount + newCount > SIZE_MAX / sizeof(ConfLayerItem))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	ConfLayerItem* items = malloc((oldCount + newCount > 0 ? oldCount + newCount : 1) * sizeof(ConfLayerItem));
+	if (!items)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	// Note: both item arrays are sorted, new layer items replace or unset the equal old ones.
+	size_t oldIndex = 0, newIndex = 0, itemCount = 0;
+	while (oldIndex < oldCount || newIndex < newCount)
+	{
+		int result;
+		ConfLayerItem newItem;
+		if (newIndex < newCount)
+		{
+			getConfReaderItem(confReader, newIndex, &newItem.key, &newItem.keyLength, NULL);
+			result = oldIndex < oldCount ? compareConfLayerKeys(oldItems[oldIndex].key,
+				oldItems[oldIndex].keyLength, newItem.key, newItem.keyLength) : 1;
+		}
+		else
+		{
+			result = -1;
+		}
+
+		if (result < 0)
+		{
+			items[itemCount++] = oldItems[oldIndex++];
+			continue;
+		}
+		if (result == 0)
+			oldIndex++;
+
+		if (!isConfLayerItemUnset(confReader, newIndex))
+		{
+			newItem.reader = confReader;
+			newItem.handle = newIndex;
+			items[itemCount++] = newItem;
+		}
+		newIndex++;
+	}
+
+	ConfLayerSlot* slots; size_t hashMask;
+	ConfResult confResult = buildConfLayerSlots(items, itemCount, &slots, &hashMask);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		free(items);
+		return confResult;
+	}
+
+	free(confLayers->slots);
+	free(confLayers->items);
+	confLayers->readers[confLayers->readerCount++] = confReader;
+	confLayers->items = items;
+	confLayers->slots = slots;
+	confLayers->itemCount = itemCount;
+	confLayers->hashMask = hashMask;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+inline static ConfResult checkConfLayerValue(const char* value)
+{
+	if (strpbrk(value, "\r\n"))
+		return BAD_VALUE_CONF_RESULT;
+	return SUCCESS_CONF_RESULT;
+}
+inline static ConfResult checkConfLayerKey(const char* key, size_t keyLength)
+{
+	if (keyLength == 0 || key[0] == '#')
+		return BAD_KEY_CONF_RESULT;
+	for (size_t i = 0; i < keyLength; i++)
+	{
+		if (key[i] == ':' || key[i] == '\n' || key[i] == '\r')
+			return BAD_KEY_CONF_RESULT;
+	}
+	return SUCCESS_CONF_RESULT;
+}
+
+// Note: each source entry takes one line, so parse error line is also the entry number.
+inline static ConfResult addConfLayersLines(ConfLayers confLayers, char* data, size_t size, size_t* errorLine)
+{
+	ConfReader confReader; size_t line;
+	ConfResult confResult = createDataConfReaderN(data, size, &confReader, &line);
+	free(data);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		if (errorLine)
+			*errorLine = line;
+		return confResult;
+	}
+
+	confResult = addConfLayersReader(confLayers, confReader);
+	if (confResult != SUCCESS_CONF_RESULT)
+		destroyConfReader(confReader);
+	if (errorLine)
+		*errorLine = 0;
+	return confResult;
+}
+
+ConfResult addConfLayersEnvironment(ConfLayers confLayers,
+	const char* const* environment, const char* prefix, size_t* errorLine)
+{
+	assert(confLayers != NULL);
+	assert(prefix != NULL);
+
+	if (!environment)
+		environment = confEnvironment;
+
+	size_t prefixLength = strlen(prefix), dataSize = 0;
+	for (size_t i = 0; environment[i]; i++)
+	{
+		if (strncmp(environment[i], prefix, prefixLength) == 0)
+			dataSize += strlen(environment[i] + prefixLength) + 1;
+		dataSize++;
+	}
+
+	char* data = malloc(dataSize + 1);
+	if (!data)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	size_t size = 0;
+	for (size_t i = 0; environment[i]; i++)
+	{
+		const char* variable = environment[i];
+		const char* value = strchr(variable, '=');
+		if (!value || strncmp(variable, prefix, prefixLength) != 0 || (size_t)(value - variable) < prefixLength)
+		{
+			data[size++] = '\n';
+			continue;
+		}
+
+		const char* key = variable + prefixLength;
+		size_t keyLength = (size_t)(value - key);
+
+		ConfResult confResult = checkConfLayerKey(key, keyLength);
+		if (confResult == SUCCESS_CONF_RESULT)
+			confResult = checkConfLayerValue(value + 1);
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			free(data);
+			if (errorLine)
+				*errorLine = i + 1;
+			return confResult;
+		}
+
+		// Note: empty value is treated as not set, so "APP_KEY=" doesn't override the previous layers.
+		if (value[1] == '\0')
+		{
+			data[size++] = '\n';
+			continue;
+		}
+
+		for (size_t j = 0; j < keyLength; j++)
+		{
+			if (key[j] == '_' && j + 1 < keyLength && key[j + 1] == '_')
+			{
+				data[size++] = '.'; j++;
+			}
+			else
+			{
+				data[size++] = key[j];
+			}
+		}
+
+		size_t valueLength = strlen(++value);
+		data[size++] = ':'; data[size++] = ' ';
+		memcpy(data + size, value, valueLength);
+		size += valueLength;
+		data[size++] = '\n';
+	}
+
+	return addConfLayersLines(confLayers, data, size, errorLine);
+}
+
+ConfResult addConfLayersArguments(ConfLayers confLayers,
+	int argumentCount, const char* const* arguments, size_t* errorLine)
+{
+	assert(confLayers != NULL);
+	assert(arguments != NULL || argumentCount == 0);
+
+	size_t dataSize = 0;
+	for (int i = 0; i < argumentCount; i++)
+		dataSize += strlen(arguments[i]) + 2;
+
+	char* data = malloc(dataSize + 1);
+	if (!data)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	// Note: first argument is the program name.
+	size_t size = 0; bool isEnded = false;
+	for (int i = 0; i < argumentCount; i++)
+	{
+		const char* argument = arguments[i];
+		if (i == 0 || isEnded || argument[0] != '-' || argument[1] != '-')
+		{
+			data[size++] = '\n';
+			continue;
+		}
+		if (argument[2] == '\0')
+		{
+			isEnded = true;
+			data[size++] = '\n';
+			continue;
+		}
+
+		const char* key = argument + 2;
+		const char* value = strchr(key, '=');
+		if (!value)
+		{
+			data[size++] = '\n';
+			continue;
+		}
+
+		size_t keyLength = (size_t)(value - key);
+		ConfResult confResult = checkConfLayerKey(key, keyLength);
+		if (confResult == SUCCESS_CONF_RESULT)
+			confResult = checkConfLayerValue(value + 1);
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			free(data);
+			if (errorLine)
+				*errorLine = (size_t)i + 1;
+			return confResult;
+		}
+
+		if (value[1] == '\0')
+		{
+			data[size++] = '\n';
+			continue;
+		}
+
+		size_t valueLength = strlen(++value);
+		memcpy(data + size, key, keyLength);
+		size += keyLength;
+		data[size++] = ':'; data[size++] = ' ';
+		memcpy(data + size, value, valueLength);
+		size += valueLength;
+		data[size++] = '\n';
+	}
+
+	return addConfLayersLines(confLayers, data, size, errorLine);
+}
+
+//**********************************************************************************************************************
+size_t getConfLayersCount(ConfLayers confLayers)
+{
+	assert(confLayers != NULL);
+	return confLayers->readerCount;
+}
+size_t getConfLayersItemCount(ConfLayers confLayers)
+{
+	assert(confLayers != NULL);
+	return confLayers->itemCount;
+}
+
+void getConfLayersItem(ConfLayers confLayers, size_t index, const char** key,
+	size_t* keyLength, ConfReader* confReader, size_t* handle)
+{
+	assert(confLayers != NULL);
+	assert(index < confLayers->itemCount);
+	assert(key != NULL);
+	assert(confReader != NULL);
+	assert(handle != NULL);
+
+	const ConfLayerItem* item = &confLayers->items[index];
+	*key = item->key;
+	if (keyLength)
+		*keyLength = item->keyLength;
+	*confReader = item->reader;
+	*handle = item->handle;
+}
+
+bool resolveConfLayersKey(ConfLayers confLayers, const char* key,
+	size_t keyLength, ConfReader* confReader, size_t* handle)
+{
+	assert(confLayers != NULL);
+	assert(key != NULL);
+	assert(confReader != NULL);
+	assert(handle != NULL);
+
+	const ConfLayerSlot* slots = confLayers->slots;
+	if (!slots)
+		return false;
+
+	const ConfLayerItem* items = confLayers->items;
+	uint64_t hash = hashConfKey(key, keyLength, 0);
+	size_t hashMask = confLayers->hashMask;
+	uint32_t slotHash = (uint32_t)(hash >> 32);
+
+	for (size_t i = (size_t)hash & hashMask; slots[i].index != 0; i = (i + 1) & hashMask)
+	{
+		if (slots[i].hash != slotHash)
+			continue;
+
+		const ConfLayerItem* item = &items[slots[i].index - 1];
+		if (item->keyLength == keyLength && memcmp(item->key, key, keyLength * sizeof(char)) == 0)
+		{
+			*confReader = item->reader;
+			*handle = item->handle;
+			return true;
+		}
+	}
+	return false;
+}
+
+//**********************************************************************************************************************
+bool getConfLayersType(ConfLayers confLayers, const char* key, ConfDataType* type)
+{
+	assert(key != NULL);
+	assert(type != NULL);
+
+	ConfReader confReader; size_t handle;
+	if (!resolveConfLayersKey(confLayers, key, strlen(key), &confReader, &handle))
+		return false;
+
+	*type = getConfReaderTypeAt(confReader, handle);
+	return true;
+}
+bool getConfLayersInt(ConfLayers confLayers, const char* key, int64_t* value)
+{
+	assert(key != NULL);
+	assert(value != NULL);
+
+	ConfReader confReader; size_t handle;
+	return resolveConfLayersKey(confLayers, key, strlen(key), &confReader, &handle) &&
+		getConfReaderIntAt(confReader, handle, value);
+}
+bool getConfLayersFloat(ConfLayers confLayers, const char* key, double* value)
+{
+	assert(key != NULL);
+	assert(value != NULL);
+
+	ConfReader confReader; size_t handle;
+	return resolveConfLayersKey(confLayers, key, strlen(key), &confReader, &handle) &&
+		getConfReaderFloatAt(confReader, handle, value);
+}
+bool getConfLayersBool(ConfLayers confLayers, const char* key, bool* value)
+{
+	assert(key != NULL);
+	assert(value != NULL);
+
+	ConfReader confReader; size_t handle;
+	return resolveConfLayersKey(confLayers, key, strlen(key), &confReader, &handle) &&
+		getConfReaderBoolAt(confReader, handle, value);
+}
+bool getConfLayersString(ConfLayers confLayers, const char* key, const char** value, uint64_t* length)
+{
+	assert(key != NULL);
+	assert(value != NULL);
+
+	ConfReader confReader; size_t handle;
+	return resolveConfLayersKey(confLayers, key, strlen(key), &confReader, &handle) &&
+		getConfReaderStringAt(confReader, handle, value, length);
+}
@@ -12,12 +12,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#if __linux__ && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // Note: for the newlocale() and strtod_l().
+#endif
+
 #include "conf/reader.h"
 #include "mpio/file.h"
 
 #include <math.h>
+#include <time.h>
+#include <float.h>
 #include <ctype.h>
-#include <errno.h>
+#include <stddef.h>
+#include <locale.h>
 #include <assert.h>
 #include <string.h>
 #include <stdlib.h>
@@ -30,9 +37,57 @@
 #error Unknown operating system
 #endif
 
+#if _WIN32
+typedef _locale_t ConfLocale;
+#define createConfLocale() _create_locale(LC_NUMERIC, "C")
+#define destroyConfLocale(locale) _free_locale(locale)
+#define parseConfDouble(string, locale) _strtod_l(string, NULL, locale)
+#define loadConfLocale(address) ((ConfLocale)_InterlockedCompareExchangePointer((void* volatile*)(address), NULL, NULL))
+#define compareExchangeConfLocale(address, desired) \
+	(_InterlockedCompareExchangePointer((void* volatile*)(address), desired, NULL) == NULL)
+#define incrementConfCounter(address) ((uint64_t)_InterlockedIncrement64((volatile long long*)(address)))
+#else
+#if __APPLE__
+#include <xlocale.h>
+#endif
+typedef locale_t ConfLocale;
+#define createConfLocale() newlocale(LC_NUMERIC_MASK, "C", (locale_t)0)
+#define destroyConfLocale(locale) freelocale(locale)
+#define parseConfDouble(string, locale) strtod_l(string, NULL, locale)
+#define loadConfLocale(address) __atomic_load_n(address, __ATOMIC_ACQUIRE)
+#define compareExchangeConfLocale(address, desired) __sync_bool_compare_and_swap(address, (locale_t)0, desired)
+#define incrementConfCounter(address) __atomic_add_fetch(address, 1, __ATOMIC_RELAXED)
+#endif
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define CONF_SIMD_X86 1
+#include <immintrin.h>
+#if _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define prefetchConfData(address) __builtin_prefetch(address)
+#elif CONF_SIMD_X86
+#define prefetchConfData(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define prefetchConfData(address) ((void)(address))
+#endif
+
 typedef struct ConfString
 {
-	char* value;
+	uint64_t offset;
 	uint64_t length;
 } ConfString;
 typedef union ConfValue
@@ -45,568 +100,3060 @@ typedef union ConfValue
 
 typedef struct ConfItem
 {
-	char* key;
-	size_t keySize;
+	uint64_t keyOffset;
+	uint32_t keySize;
+	uint32_t line;
 	ConfValue value;
 	ConfDataType type;
 } ConfItem;
 
+typedef struct ConfHashSlot
+{
+	uint32_t hash;
+	uint32_t index;
+} ConfHashSlot;
+
+typedef struct ConfSection ConfSection;
+
 struct ConfReader_T
 {
 	ConfItem* items;
+	char* data;
+	ConfHashSlot* hashSlots;
+	ConfSection* sections;
 	size_t itemCount;
+	size_t hashMask;
+	uint64_t hashSeed;
+	size_t sectionCount;
+	size_t keySkip;
+	size_t dataSize;
+	void* image;
+	size_t imageSize;
+	bool isBorrowed;
+	bool isView;
+	bool isHashMapped;
+};
+
+struct ConfSection
+{
+	const char* name;
+	size_t nameSize;
+	ConfReader_T view;
 };
 
+// Note: image stores items and hash slots in the reader memory layout, so they are used in place.
+#define CONF_IMAGE_MAGIC 0x4D494643u // "CFIM" in the little endian byte order.
+#define CONF_IMAGE_VERSION 1
+
+typedef struct ConfImageHeader
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t itemSize;
+	uint64_t checksum;
+	uint64_t imageSize;
+	uint64_t itemCount;
+	uint64_t slotCount;
+	uint64_t hashSeed;
+	uint64_t sectionCount;
+	uint64_t dataSize;
+} ConfImageHeader;
+
+typedef struct ConfImageSection
+{
+	uint64_t nameOffset;
+	uint64_t nameSize;
+	uint64_t first;
+	uint64_t count;
+} ConfImageSection;
+
 //**********************************************************************************************************************
-inline static int compareConfItems(const void* a, const void* b)
+inline static bool isConfDataBorrowed(ConfReader confReader)
+{
+	// Note: section views and images are also not owners, but their strings are null terminated.
+	return confReader->isBorrowed && !confReader->isView && !confReader->image;
+}
+inline static int compareConfKeys(const char* keyA, size_t keySizeA, const char* keyB, size_t keySizeB)
 {
-	// NOTE: a and b should not be NULL!
+	// NOTE: keyA and keyB should not be NULL!
 	// Skipping here assertions for debug build speed.
-	const ConfItem* itemA = a;
-	const ConfItem* itemB = b;
-	if (itemA->keySize != itemB->keySize)
-		return itemA->keySize < itemB->keySize ? -1 : 1;
-	return memcmp(itemA->key, itemB->key, itemA->keySize * sizeof(char));
+	// Lexicographic order, so keys with a common prefix are stored next to each other.
+	int result = memcmp(keyA, keyB, (keySizeA < keySizeB ? keySizeA : keySizeB) * sizeof(char));
+	if (result != 0)
+		return result;
+	if (keySizeA != keySizeB)
+		return keySizeA < keySizeB ? -1 : 1;
+	return 0;
 }
-
-inline static void destroyConfItems(ConfItem* items, size_t itemCount)
+inline static int compareConfItems(const ConfItem* itemA, const ConfItem* itemB, const char* data)
 {
-	assert(itemCount == 0 || (items != NULL && itemCount > 0));
+	return compareConfKeys(data + itemA->keyOffset, (size_t)itemA->keySize,
+		data + itemB->keyOffset, (size_t)itemB->keySize);
+}
 
-	for (size_t i = 0; i < itemCount; i++)
+inline static bool mergeConfItems(const ConfItem* source, ConfItem* target, size_t left,
+	size_t middle, size_t right, const char* data, size_t* repeatLine, size_t* firstLine)
+{
+	assert(source != NULL);
+	assert(target != NULL);
+	assert(repeatLine != NULL);
+	assert(firstLine != NULL);
+
+	size_t i = left, j = middle, k = left;
+	int order = compareConfItems(&source[middle - 1], &source[middle], data);
+	if (order < 0)
 	{
-		ConfItem item = items[i];
-		if (item.type == STRING_CONF_DATA_TYPE)
-			free(item.value.string.value);
-		free(item.key);
+		memcpy(target + left, source + left, (right - left) * sizeof(ConfItem));
+		return true;
 	}
-
-	free(items);
-}
-inline static ConfResult createConfItems(int(*getNextChar)(void*), void* handle,
-	ConfItem** _items, size_t* _itemCount, size_t* errorLine)
-{
-	assert(getNextChar != NULL);
-	assert(_items != NULL);
-	assert(_itemCount != NULL);
-
-	ConfItem* items = malloc(sizeof(struct ConfItem));
-	if (!items)
+	
+	if (order == 0)
 	{
-		if (errorLine)
-			*errorLine = 0;
-		return FAILED_TO_ALLOCATE_CONF_RESULT;
+		i = middle - 1;
 	}
-
-	size_t itemCount = 0;
-	size_t itemCapacity = 1;
-
-	char* buffer = malloc(sizeof(char));
-	if (!buffer)
+	else
 	{
-		free(items);
-		if (errorLine)
-			*errorLine = 0;
-		return FAILED_TO_ALLOCATE_CONF_RESULT;
+		while (i < middle && j < right)
+		{
+			order = compareConfItems(&source[j], &source[i], data);
+			if (order == 0)
+				break;
+			if (order < 0)
+				target[k++] = source[j++];
+			else
+				target[k++] = source[i++];
+		}
 	}
 
-	size_t bufferSize = 0, bufferCapacity = 1, lineIndex = 0;
-	
-	ConfItem item;
-	memset(&item, 0, sizeof(struct ConfItem));
+	if (order == 0)
+	{
+		size_t lineA = source[i].line, lineB = source[j].line;
+		*repeatLine = lineA > lineB ? lineA : lineB;
+		*firstLine = lineA > lineB ? lineB : lineA;
+		return false;
+	}
 
-	while (true)
+	while (i < middle)
+		target[k++] = source[i++];
+	while (j < right)
+		target[k++] = source[j++];
+	return true;
+}
+inline static bool sortConfItems(ConfItem* items, ConfItem* buffer,
+	size_t itemCount, const char* data, size_t* repeatLine, size_t* firstLine)
+{
+	assert(itemCount == 0 || (items != NULL && buffer != NULL));
+	assert(repeatLine != NULL);
+	assert(firstLine != NULL);
+
+	// Note: bottom-up merge sort, because qsort() has no way to pass the key storage.
+	// Equal keys always meet in one of the merges, so duplicates are detected here too.
+	ConfItem* source = items; ConfItem* target = buffer;
+	for (size_t width = 1; width < itemCount; width *= 2)
 	{
-		int currentChar = getNextChar(handle);
-		if (currentChar == ':' && item.keySize == 0)
+		for (size_t left = 0; left < itemCount; left += width * 2)
 		{
-			if (bufferSize == 0)
-			{
-				free(buffer); destroyConfItems(items, itemCount);
-				if (errorLine)
-					*errorLine = lineIndex + 1;
-				return BAD_KEY_CONF_RESULT;
-			}
+			size_t middle = left + width < itemCount ? left + width : itemCount;
+			size_t right = middle + width < itemCount ? middle + width : itemCount;
 
-			char* key = malloc((bufferSize + 1) * sizeof(char));
-			if (!key)
+			if (middle == right)
 			{
-				free(buffer); destroyConfItems(items, itemCount);
-				if (errorLine)
-					*errorLine = lineIndex + 1;
-				return FAILED_TO_ALLOCATE_CONF_RESULT;
+				memcpy(target + left, source + left, (right - left) * sizeof(ConfItem));
+				continue;
 			}
 
-			memcpy(key, buffer, bufferSize * sizeof(char));
-			key[bufferSize] = '\0';
-
-			item.key = key;
-			item.keySize = bufferSize;
-			bufferSize = 0;
-			continue;
+			if (!mergeConfItems(source, target, left, middle, right, data, repeatLine, firstLine))
+				return false;
 		}
-		else if (currentChar == '\n' || currentChar == EOF || currentChar == '\0')
-		{
-			if (item.keySize == 0)
-			{
-				if (bufferSize > 0)
-				{
-					free(buffer);
-					destroyConfItems(items, itemCount);
-					if (errorLine)
-						*errorLine = lineIndex + 1;
-					return BAD_ITEM_CONF_RESULT;
-				}
-
-				if (currentChar == EOF || currentChar == '\0') break;
-
-				bufferSize = 0;
-				lineIndex++;
-				continue;
-			}
 
-			if (bufferSize <= 1 || buffer[0] != ' ')
-			{
-				free(item.key); free(buffer);
-				destroyConfItems(items, itemCount);
-				if (errorLine)
-					*errorLine = lineIndex + 1;
-				return BAD_VALUE_CONF_RESULT;
-			}
+		ConfItem* swap = source; source = target; target = swap;
+	}
 
-			if (bufferSize == bufferCapacity)
-			{
-				bufferCapacity *= 2;
-
-				char* newBuffer = realloc(buffer,
-					bufferCapacity * sizeof(char));
-
-				if (!newBuffer)
-				{
-					free(item.key);
-					free(buffer);
-					destroyConfItems(items, itemCount);
-					if (errorLine)
-						*errorLine = lineIndex + 1;
-					return FAILED_TO_ALLOCATE_CONF_RESULT;
-				}
-
-				buffer = newBuffer;
-			}
+	if (source != items)
+		memcpy(items, source, itemCount * sizeof(ConfItem));
+	return true;
+}
 
-			buffer[bufferSize] = '\n';
-			char* bufferValue = buffer + 1;
-			size_t bufferValueSize = bufferSize - 1;
-			char firstChar = bufferValue[0];
+//**********************************************************************************************************************
+#define CONF_ROTATE_LEFT(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+#define CONF_SIP_ROUND()                                                             \
+	v0 += v1; v1 = CONF_ROTATE_LEFT(v1, 13); v1 ^= v0; v0 = CONF_ROTATE_LEFT(v0, 32); \
+	v2 += v3; v3 = CONF_ROTATE_LEFT(v3, 16); v3 ^= v2;                                \
+	v0 += v3; v3 = CONF_ROTATE_LEFT(v3, 21); v3 ^= v0;                                \
+	v2 += v1; v1 = CONF_ROTATE_LEFT(v1, 17); v1 ^= v2; v2 = CONF_ROTATE_LEFT(v2, 32)
+
+uint64_t hashConfKey(const char* key, size_t keySize, uint64_t seed)
+{
+	assert(key != NULL || keySize == 0);
 
-			bool converted = false;
-			char* endChar = NULL;
+	// Note: SipHash-1-3, keyed with the seed so colliding keys can't be precomputed.
+	uint64_t k0 = seed, k1 = ~seed;
+	uint64_t v0 = k0 ^ 0x736f6d6570736575ull, v1 = k1 ^ 0x646f72616e646f6dull;
+	uint64_t v2 = k0 ^ 0x6c7967656e657261ull, v3 = k1 ^ 0x7465646279746573ull;
+	const uint8_t* bytes = (const uint8_t*)key;
 
-			if (isdigit(firstChar) != 0 || firstChar == '-')
-			{
-				errno = 0;
-				int64_t integer = strtoll(bufferValue, &endChar, 10);
-
-				if (bufferValue != endChar && errno == 0)
-				{
-					char end = *endChar;
-					if (end == '\n')
-					{
-						item.value.integer = integer;
-						item.type = INTEGER_CONF_DATA_TYPE;
-						converted = true;
-					}
-					else if (end == '.' && isdigit(*(endChar + 1)) != 0)
-					{
-						endChar++;
-
-						errno = 0;
-						char* fractionEndChar;
-						int64_t fraction = strtoll(endChar, &fractionEndChar, 10);
-
-						if (endChar != fractionEndChar && errno == 0 && 
-							*fractionEndChar == '\n' && fraction >= 0)
-						{
-							double half = (double)fraction /
-								pow(10, (double)(fractionEndChar - endChar));
-							item.value.floating = firstChar == '-' ?
-								(double)integer - half : (double)integer + half;
-							item.type = FLOATING_CONF_DATA_TYPE;
-							converted = true;
-						}
-					}
-				}
-			}
+	size_t blockEnd = keySize - keySize % 8;
+	for (size_t i = 0; i < blockEnd; i += 8)
+	{
+		uint64_t block = 0;
+		for (int j = 0; j < 8; j++)
+			block |= (uint64_t)bytes[i + j] << (j * 8);
+		v3 ^= block;
+		CONF_SIP_ROUND();
+		v0 ^= block;
+	}
 
-			if (!converted)
-			{
-				if (bufferValueSize >= 5)
-				{
-					if (compareNoCase(bufferValue, "false", 5) == 0)
-					{
-						item.value.boolean = false;
-						item.type = BOOLEAN_CONF_DATA_TYPE;
-						converted = true;
-					}
-				}
-				else if (bufferValueSize >= 4)
-				{
-					if (compareNoCase(bufferValue, "true", 4) == 0)
-					{
-						item.value.boolean = true;
-						item.type = BOOLEAN_CONF_DATA_TYPE;
-						converted = true;
-					}
-					else if (compareNoCase(bufferValue, "-inf", 4) == 0)
-					{
-						item.value.floating = -INFINITY;
-						item.type = FLOATING_CONF_DATA_TYPE;
-						converted = true;
-					}
-				}
-				else if (bufferValueSize >= 3)
-				{
-					if (compareNoCase(bufferValue, "inf", 3) == 0)
-					{
-						item.value.floating = INFINITY;
-						item.type = FLOATING_CONF_DATA_TYPE;
-						converted = true;
-					}
-					else if (compareNoCase(bufferValue, "nan", 3) == 0)
-					{
-						item.value.floating = NAN;
-						item.type = FLOATING_CONF_DATA_TYPE;
-						converted = true;
-					}
-				}
-			}
+	uint64_t block = (uint64_t)keySize << 56;
+	for (size_t i = blockEnd; i < keySize; i++)
+		block |= (uint64_t)bytes[i] << ((i - blockEnd) * 8);
+	v3 ^= block;
+	CONF_SIP_ROUND();
+	v0 ^= block;
+
+	v2 ^= 0xff;
+	CONF_SIP_ROUND();
+	CONF_SIP_ROUND();
+	CONF_SIP_ROUND();
+	return v0 ^ v1 ^ v2 ^ v3;
+}
 
-			if (!converted)
-			{
-				char* string = malloc(bufferSize * sizeof(char));
-				if (!string)
-				{
-					free(item.key); free(buffer);
-					destroyConfItems(items, itemCount);
-					if (errorLine)
-						*errorLine = lineIndex + 1;
-					return FAILED_TO_ALLOCATE_CONF_RESULT;
-				}
-
-				memcpy(string, bufferValue, bufferValueSize * sizeof(char));
-				string[bufferValueSize] = '\0';
-
-				item.value.string.value = string;
-				item.value.string.length = bufferValueSize;
-				item.type = STRING_CONF_DATA_TYPE;
-			}
+static volatile uint64_t confSeedCounter = 0;
 
-			if (itemCount == itemCapacity)
-			{
-				itemCapacity *= 2;
-
-				ConfItem* newItems = realloc(items,
-					itemCapacity * sizeof(struct ConfItem));
-
-				if (!newItems)
-				{
-					if (item.type == STRING_CONF_DATA_TYPE)
-						free(item.value.string.value);
-					free(item.key); free(buffer);
-					destroyConfItems(items, itemCount);
-					if (errorLine)
-						*errorLine = lineIndex + 1;
-					return FAILED_TO_ALLOCATE_CONF_RESULT;
-				}
-
-				items = newItems;
-			}
+/*
+ * Returns a new unpredictable hash seed, mixed from the stack and heap addresses (ASLR), time and a counter.
+ */
+static uint64_t getConfRandomSeed(const void* data)
+{
+	uint64_t entropy[5];
+	entropy[0] = (uint64_t)(uintptr_t)&entropy;
+	entropy[1] = (uint64_t)(uintptr_t)data;
+	entropy[2] = (uint64_t)time(NULL);
+	entropy[3] = (uint64_t)clock();
+	entropy[4] = incrementConfCounter(&confSeedCounter);
+	return hashConfKey((const char*)entropy, sizeof(entropy), (uint64_t)(uintptr_t)&confSeedCounter);
+}
 
-			items[itemCount++] = item;
-			if (currentChar == EOF || currentChar == '\0')
-				break;
+inline static const ConfItem* findConfHashItem(ConfReader confReader, const char* key, size_t keySize, uint64_t hash)
+{
+	assert(confReader != NULL);
+	assert(confReader->hashSlots != NULL);
+	assert(key != NULL);
 
-			item.keySize = 0;
-			bufferSize = 0;
-			lineIndex++;
-			continue;
-		}
-		else if (currentChar == '#' && bufferSize == 0 && item.keySize == 0)
-		{
-			while(true)
-			{
-				currentChar = getNextChar(handle);
-				if (currentChar == '\n' || currentChar == EOF || currentChar == '\0')
-					break;
-			}
+	const ConfItem* items = confReader->items;
+	const char* data = confReader->data + confReader->keySkip;
+	const ConfHashSlot* hashSlots = confReader->hashSlots;
+	size_t hashMask = confReader->hashMask, keySkip = confReader->keySkip;
+	uint32_t slotHash = (uint32_t)(hash >> 32);
 
-			lineIndex++;
-			continue;
-		}
-		else if (currentChar == '\r')
-		{
+	for (size_t i = (size_t)hash & hashMask; hashSlots[i].index != 0; i = (i + 1) & hashMask)
+	{
+		if (hashSlots[i].hash != slotHash)
 			continue;
-		}
-
-		if (bufferSize == bufferCapacity)
-		{
-			bufferCapacity *= 2;
-
-			char* newBuffer = realloc(buffer,
-				bufferCapacity * sizeof(char));
-
-			if (!newBuffer)
-			{
-				if (item.keySize > 0)
-					free(item.key);
-				free(buffer); destroyConfItems(items, itemCount);
-				if (errorLine)
-					*errorLine = lineIndex + 1;
-				return FAILED_TO_ALLOCATE_CONF_RESULT;
-			}
 
-			buffer = newBuffer;
-		}
-
-		buffer[bufferSize++] = (char)currentChar;
+		const ConfItem* item = &items[hashSlots[i].index - 1];
+		if (item->keySize - keySkip == keySize && memcmp(data + item->keyOffset, key, keySize * sizeof(char)) == 0)
+			return item;
 	}
+	return NULL;
+}
+inline static const ConfItem* findConfItem(ConfReader confReader, const char* key, size_t keySize)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
 
-	free(buffer);
+	if (confReader->hashSlots)
+		return findConfHashItem(confReader, key, keySize, hashConfKey(key, keySize, confReader->hashSeed));
 
-	for (size_t i = 0; i < itemCount; i++)
+	// Note: section view keys share the same prefix, it's skipped in comparisons.
+	const ConfItem* items = confReader->items;
+	const char* data = confReader->data + confReader->keySkip;
+	size_t low = 0, high = confReader->itemCount, keySkip = confReader->keySkip;
+	while (low < high)
 	{
-		for (size_t j = 0; j < itemCount; j++)
-		{
-			if (i != j && !compareConfItems(&items[i], &items[j]))
-			{
-				destroyConfItems(items, itemCount);
-				if (errorLine)
-					*errorLine = 0;
-				return REPEATING_KEYS_CONF_RESULT;
-			}
-		}
+		size_t middle = low + (high - low) / 2;
+		const ConfItem* item = &items[middle];
+		int result = compareConfKeys(key, keySize, data + item->keyOffset, (size_t)item->keySize - keySkip);
+		if (result == 0)
+			return item;
+		if (result < 0)
+			high = middle;
+		else
+			low = middle + 1;
 	}
+	return NULL;
+}
 
-	qsort(items, itemCount, sizeof(struct ConfItem), compareConfItems);
+//**********************************************************************************************************************
+// Note: line scanners return line size and the first ':' index before the new line, or SIZE_MAX.
 
-	*_items = items;
-	*_itemCount = itemCount;
-	return SUCCESS_CONF_RESULT;
+inline static size_t scanConfLineScalar(const char* data, size_t size, size_t* separator)
+{
+	const char* lineEnd = memchr(data, '\n', size);
+	size_t lineSize = lineEnd ? (size_t)(lineEnd - data) : size;
+	const char* colon = memchr(data, ':', lineSize);
+	*separator = colon ? (size_t)(colon - data) : SIZE_MAX;
+	return lineSize;
 }
 
-//**********************************************************************************************************************
-static int onNextFileChar(void* handle)
+#if CONF_SIMD_X86
+inline static uint32_t countTrailingZeros(uint32_t mask)
 {
-	// NOTE: handle should not be NULL!
-	// Skipping here assertion for debug build speed.
-	return getc(handle);
+	// NOTE: mask should not be zero!
+#if _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (uint32_t)index;
+#else
+	return (uint32_t)__builtin_ctz(mask);
+#endif
 }
-ConfResult createFileConfReader(const char* filePath, ConfReader* confReader, size_t* errorLine)
+inline static bool findConfLineMasks(uint32_t lineMask, uint32_t colonMask,
+	size_t index, size_t* separator, size_t* lineSize)
 {
-	assert(filePath != NULL);
-	assert(confReader != NULL);
-
-	ConfReader confReaderInstance = malloc(sizeof(ConfReader_T));
-	if (!confReaderInstance)
+	if (*separator == SIZE_MAX)
 	{
-		if (errorLine)
-			*errorLine = 0;
-		return FAILED_TO_ALLOCATE_CONF_RESULT;
+		// Note: keeping only colons located before the first new line.
+		if (lineMask != 0)
+			colonMask &= lineMask ^ (lineMask - 1);
+		if (colonMask != 0)
+			*separator = index + countTrailingZeros(colonMask);
 	}
 
-	FILE* file = openFile(filePath, "r");
-	if (!file)
-	{
-		free(confReaderInstance);
-		if (errorLine)
-			*errorLine = 0;
-		return FAILED_TO_OPEN_FILE_CONF_RESULT;
-	}
+	if (lineMask == 0)
+		return false;
 
-	ConfItem* items;
-	size_t itemCount;
+	*lineSize = index + countTrailingZeros(lineMask);
+	return true;
+}
 
-	ConfResult result = createConfItems(onNextFileChar,
-		file, &items, &itemCount, errorLine);
-	closeFile(file);
+static size_t scanConfLineSSE2(const char* data, size_t size, size_t* separator)
+{
+	const __m128i newLines = _mm_set1_epi8('\n');
+	const __m128i colons = _mm_set1_epi8(':');
+	size_t index = 0, lineSize;
+	*separator = SIZE_MAX;
 
-	if (result != SUCCESS_CONF_RESULT)
+	for (; index + 16 <= size; index += 16)
 	{
-		free(confReaderInstance);
-		return result;
+		__m128i block = _mm_loadu_si128((const __m128i*)(data + index));
+		uint32_t lineMask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, newLines));
+		uint32_t colonMask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, colons));
+		if (findConfLineMasks(lineMask, colonMask, index, separator, &lineSize))
+			return lineSize;
 	}
 
-	confReaderInstance->items = items;
-	confReaderInstance->itemCount = itemCount;
-	*confReader = confReaderInstance;
-	if (errorLine)
-		*errorLine = 0;
-	return SUCCESS_CONF_RESULT;
+	size_t tailSeparator;
+	lineSize = index + scanConfLineScalar(data + index, size - index, &tailSeparator);
+	if (*separator == SIZE_MAX && tailSeparator != SIZE_MAX)
+		*separator = index + tailSeparator;
+	return lineSize;
 }
 
-typedef struct ConfReaderIterator
-{
-	const char* data;
-	size_t index;
-} ConfReaderIterator;
-static int onNextDataChar(void* handle)
-{
-	// NOTE: handle should not be NULL!
-	// Skipping here assertion for debug build speed.
-	ConfReaderIterator* iterator = handle;
-	return iterator->data[iterator->index++];
-}
-ConfResult createDataConfReader(const char* data, ConfReader* confReader, size_t* errorLine)
+#if !_MSC_VER
+__attribute__((target("avx2")))
+#endif
+static size_t scanConfLineAVX2(const char* data, size_t size, size_t* separator)
 {
-	assert(data != NULL);
-	assert(confReader != NULL);
-	assert(errorLine != NULL);
+	const __m256i newLines = _mm256_set1_epi8('\n');
+	const __m256i colons = _mm256_set1_epi8(':');
+	size_t index = 0, lineSize;
+	*separator = SIZE_MAX;
 
-	ConfReader confReaderInstance = malloc(sizeof(ConfReader_T));
-	if (!confReaderInstance)
+	for (; index + 32 <= size; index += 32)
 	{
-		*errorLine = 0;
-		return FAILED_TO_ALLOCATE_CONF_RESULT;
+		__m256i block = _mm256_loadu_si256((const __m256i*)(data + index));
+		uint32_t lineMask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newLines));
+		uint32_t colonMask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, colons));
+		if (findConfLineMasks(lineMask, colonMask, index, separator, &lineSize))
+			return lineSize;
 	}
 
-	ConfReaderIterator iterator;
-	iterator.data = data;
-	iterator.index = 0;
-
-	ConfItem* items;
-	size_t itemCount;
+	size_t tailSeparator;
+	lineSize = index + scanConfLineSSE2(data + index, size - index, &tailSeparator);
+	if (*separator == SIZE_MAX && tailSeparator != SIZE_MAX)
+		*separator = index + tailSeparator;
+	return lineSize;
+}
 
-	ConfResult result = createConfItems(onNextDataChar,
-		&iterator, &items, &itemCount, errorLine);
+static bool isConfAVX2Supported()
+{
+#if _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
 
-	if (result != SUCCESS_CONF_RESULT)
-	{
-		free(confReaderInstance);
-		return result;
-	}
+	__cpuid(info, 1);
+	bool hasOSXSAVE = (info[2] & (1 << 27)) != 0, hasAVX = (info[2] & (1 << 28)) != 0;
+	if (!hasOSXSAVE || !hasAVX || (_xgetbv(0) & 0x6) != 0x6)
+		return false;
 
-	confReaderInstance->items = items;
-	confReaderInstance->itemCount = itemCount;
-	*confReader = confReaderInstance;
-	return SUCCESS_CONF_RESULT;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
 }
+#endif
 
-void destroyConfReader(ConfReader confReader)
+typedef size_t(*ScanConfLine)(const char* data, size_t size, size_t* separator);
+
+inline static ScanConfLine getConfLineScanner()
 {
-	if (!confReader)
-		return;
-	destroyConfItems(confReader->items, confReader->itemCount);
-	free(confReader);
+#if CONF_SIMD_X86
+	return isConfAVX2Supported() ? scanConfLineAVX2 : scanConfLineSSE2;
+#else
+	return scanConfLineScalar;
+#endif
 }
 
 //**********************************************************************************************************************
-bool getConfReaderType(ConfReader confReader, const char* key, ConfDataType* type)
+inline static bool reserveConfData(char** data, size_t dataSize, size_t* dataCapacity, size_t length)
 {
-	assert(confReader != NULL);
-	assert(key != NULL);
-	assert(type != NULL);
+	assert(data != NULL);
+	assert(dataCapacity != NULL);
 
-	ConfItem item;
-	item.key = (char*)key;
-	item.keySize = strlen(key);
+	size_t newSize = dataSize + length;
+	if (newSize > *dataCapacity)
+	{
+		size_t capacity = *dataCapacity > 0 ? *dataCapacity : 1;
+		while (newSize > capacity)
+			capacity *= 2;
 
-	ConfItem* foundItem = bsearch(&item, confReader->items,
-		confReader->itemCount, sizeof(struct ConfItem), compareConfItems);
-	if (!foundItem)
-		return false;
+		char* newData = realloc(*data, capacity * sizeof(char));
+		if (!newData)
+			return false;
 
-	*type = foundItem->type;
+		*data = newData;
+		*dataCapacity = capacity;
+	}
 	return true;
 }
-
-bool getConfReaderInt(ConfReader confReader, const char* key, int64_t* value)
+inline static bool appendConfData(char** data, size_t* dataSize, size_t* dataCapacity,
+	const char* string, size_t length, uint64_t* offset)
 {
-	assert(confReader != NULL);
-	assert(key != NULL);
-	assert(value != NULL);
-
-	ConfItem item;
-	item.key = (char*)key;
-	item.keySize = strlen(key);
-
-	ConfItem* foundItem = bsearch(&item, confReader->items,
-		confReader->itemCount, sizeof(struct ConfItem), compareConfItems);
+	assert(dataSize != NULL);
+	assert(string != NULL || length == 0);
+	assert(offset != NULL);
 
-	if (!foundItem || foundItem->type != INTEGER_CONF_DATA_TYPE)
+	if (!reserveConfData(data, *dataSize, dataCapacity, length + 1))
 		return false;
 
-	*value = foundItem->value.integer;
+	char* target = *data + *dataSize;
+	memcpy(target, string, length * sizeof(char));
+	target[length] = '\0';
+
+	*offset = *dataSize;
+	*dataSize += length + 1;
 	return true;
 }
-
-bool getConfReaderFloat(ConfReader confReader, const char* key, double* value)
+inline static bool appendConfSectionKey(char** data, size_t* dataSize, size_t* dataCapacity,
+	uint64_t sectionOffset, size_t sectionSize, const char* key, size_t keySize, uint64_t* offset)
 {
-	assert(confReader != NULL);
+	assert(dataSize != NULL);
 	assert(key != NULL);
-	assert(value != NULL);
-
-	ConfItem item;
-	item.key = (char*)key;
-	item.keySize = strlen(key);
-
-	ConfItem* foundItem = bsearch(&item, confReader->items,
-		confReader->itemCount, sizeof(struct ConfItem), compareConfItems);
+	assert(offset != NULL);
 
-	if (!foundItem)
+	// Note: section name is already in the data, with a '.' separator.
+	if (!reserveConfData(data, *dataSize, dataCapacity, sectionSize + keySize + 1))
 		return false;
 
-	if (foundItem->type == FLOATING_CONF_DATA_TYPE)
-	{
-		*value = foundItem->value.floating;
-		return true;
-	}
-	else if (foundItem->type == INTEGER_CONF_DATA_TYPE)
-	{
-		*value = foundItem->value.integer;
-		return true;
-	}
-	return false;
+	char* target = *data + *dataSize;
+	memcpy(target, *data + sectionOffset, sectionSize * sizeof(char));
+	memcpy(target + sectionSize, key, keySize * sizeof(char));
+	target[sectionSize + keySize] = '\0';
+
+	*offset = *dataSize;
+	*dataSize += sectionSize + keySize + 1;
+	return true;
 }
+// Note: exactly representable powers of ten for the fast floating path.
+static const double confPowersOfTen[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
 
-//**********************************************************************************************************************
-bool getConfReaderBool(ConfReader confReader, const char* key, bool* value)
+inline static bool isConfDigit(char value)
 {
-	assert(confReader != NULL);
-	assert(key != NULL);
-	assert(value != NULL);
-
-	ConfItem item;
-	item.key = (char*)key;
-	item.keySize = strlen(key);
+	return (unsigned char)(value - '0') < 10;
+}
+static ConfLocale confNumericLocale = (ConfLocale)0;
 
-	ConfItem* foundItem = bsearch(&item, confReader->items,
-		confReader->itemCount, sizeof(struct ConfItem), compareConfItems);
+/*
+ * Returns the shared "C" numeric locale. It is created on first use and never destroyed.
+ */
+inline static ConfLocale getConfNumericLocale()
+{
+	ConfLocale locale = loadConfLocale(&confNumericLocale);
+	if (locale)
+		return locale;
 
-	if (!foundItem || foundItem->type != BOOLEAN_CONF_DATA_TYPE)
-		return false;
+	locale = createConfLocale();
+	if (!locale)
+		return (ConfLocale)0;
 
-	*value = foundItem->value.boolean;
-	return true;
+	// Note: other thread may have created it first, then our copy is not needed.
+	if (!compareExchangeConfLocale(&confNumericLocale, locale))
+	{
+		destroyConfLocale(locale);
+		locale = loadConfLocale(&confNumericLocale);
+	}
+	return locale;
 }
 
-bool getConfReaderString(ConfReader confReader, const char* key, const char** value, uint64_t* length)
+inline static bool parseConfNumber(const char* value, size_t valueSize, char* buffer, ConfItem* item)
 {
-	assert(confReader != NULL);
-	assert(key != NULL);
 	assert(value != NULL);
+	assert(valueSize > 0);
+	assert(buffer != NULL);
+	assert(item != NULL);
 
-	ConfItem item;
-	item.key = (char*)key;
-	item.keySize = strlen(key);
-
-	ConfItem* foundItem = bsearch(&item, confReader->items,
-		confReader->itemCount, sizeof(struct ConfItem), compareConfItems);
+	const char* current = value;
+	const char* end = value + valueSize;
 
-	if (!foundItem || foundItem->type != STRING_CONF_DATA_TYPE)
+	bool isNegative = *current == '-';
+	if (isNegative)
+		current++;
+	if (current == end || !isConfDigit(*current))
 		return false;
 
-	*value = foundItem->value.string.value;
-	if (length)
-		*length = foundItem->value.string.length;
+	// Note: keeping up to 19 significant digits, they always fit into the uint64.
+	uint64_t mantissa = 0;
+	int64_t exponent = 0;
+	int digitCount = 0;
+	bool isTruncated = false, isFloating = false;
+
+	while (current < end && isConfDigit(*current))
+	{
+		uint64_t digit = (uint64_t)(*current - '0');
+		if (digitCount < 19)
+		{
+			mantissa = mantissa * 10 + digit;
+			if (mantissa != 0)
+				digitCount++;
+		}
+		else
+		{
+			isTruncated |= digit != 0;
+			exponent++;
+		}
+		current++;
+	}
+
+	if (current < end && *current == '.')
+	{
+		const char* fractionStart = ++current;
+		while (current < end && isConfDigit(*current))
+		{
+			uint64_t digit = (uint64_t)(*current - '0');
+			if (digitCount < 19)
+			{
+				mantissa = mantissa * 10 + digit;
+				if (mantissa != 0)
+					digitCount++;
+				exponent--;
+			}
+			else
+			{
+				isTruncated |= digit != 0;
+			}
+			current++;
+		}
+
+		if (current == fractionStart)
+			return false;
+		isFloating = true;
+	}
+
+	if (current < end && (*current == 'e' || *current == 'E'))
+	{
+		current++;
+		bool isExponentNegative = false;
+		if (current < end && (*current == '-' || *current == '+'))
+			isExponentNegative = *current++ == '-';
+
+		const char* exponentStart = current;
+		int64_t exponentValue = 0;
+		while (current < end && isConfDigit(*current))
+		{
+			if (exponentValue < 100000)
+				exponentValue = exponentValue * 10 + (*current - '0');
+			current++;
+		}
+
+		if (current == exponentStart)
+			return false;
+		exponent += isExponentNegative ? -exponentValue : exponentValue;
+		isFloating = true;
+	}
+
+	if (current != end)
+		return false;
+
+	if (!isFloating)
+	{
+		// Note: integers out of the int64 range are stored as strings.
+		if (exponent != 0 || mantissa > (uint64_t)INT64_MAX + (isNegative ? 1 : 0))
+			return false;
+
+		if (isNegative && mantissa != 0)
+			item->value.integer = -(int64_t)(mantissa - 1) - 1;
+		else
+			item->value.integer = (int64_t)mantissa;
+		item->type = INTEGER_CONF_DATA_TYPE;
+		return true;
+	}
+
+	// Note: Clinger's fast path, both operands are exact, so the result is correctly rounded.
+	const uint64_t maxExactInteger = (uint64_t)1 << 53;
+	bool isExact = !isTruncated && mantissa <= maxExactInteger && exponent >= -22 && exponent <= 22 + 15;
+	for (; isExact && exponent > 22; exponent--)
+	{
+		mantissa *= 10;
+		isExact = mantissa <= maxExactInteger;
+	}
+
+	double floating;
+	if (isExact)
+	{
+		floating = (double)mantissa;
+		if (exponent < 0)
+			floating /= confPowersOfTen[-exponent];
+		else
+			floating *= confPowersOfTen[exponent];
+		if (isNegative)
+			floating = -floating;
+	}
+	else
+	{
+		// Note: strtod_l() is correctly rounded, the "C" locale keeps it independent of setlocale().
+		ConfLocale locale = getConfNumericLocale();
+		if (!locale)
+			return false; // Note: out of memory, value is stored as a string.
+
+		memcpy(buffer, value, valueSize * sizeof(char));
+		buffer[valueSize] = '\0';
+		floating = parseConfDouble(buffer, locale);
+	}
+
+	item->value.floating = floating;
+	item->type = FLOATING_CONF_DATA_TYPE;
+	return true;
+}
+
+inline static void parseConfValue(const char* value, size_t valueSize, char* buffer, ConfItem* item)
+{
+	assert(value != NULL);
+	assert(valueSize > 0);
+	assert(buffer != NULL);
+	assert(item != NULL);
+
+	if (parseConfNumber(value, valueSize, buffer, item))
+		return;
+
+	if (valueSize >= 5)
+	{
+		if (compareNoCase(value, "false", 5) == 0)
+		{
+			item->value.boolean = false;
+			item->type = BOOLEAN_CONF_DATA_TYPE;
+			return;
+		}
+	}
+	else if (valueSize >= 4)
+	{
+		if (compareNoCase(value, "true", 4) == 0)
+		{
+			item->value.boolean = true;
+			item->type = BOOLEAN_CONF_DATA_TYPE;
+			return;
+		}
+		else if (compareNoCase(value, "-inf", 4) == 0)
+		{
+			item->value.floating = -INFINITY;
+			item->type = FLOATING_CONF_DATA_TYPE;
+			return;
+		}
+	}
+	else if (valueSize >= 3)
+	{
+		if (compareNoCase(value, "inf", 3) == 0)
+		{
+			item->value.floating = INFINITY;
+			item->type = FLOATING_CONF_DATA_TYPE;
+			return;
+		}
+		else if (compareNoCase(value, "nan", 3) == 0)
+		{
+			item->value.floating = NAN;
+			item->type = FLOATING_CONF_DATA_TYPE;
+			return;
+		}
+	}
+
+	item->type = STRING_CONF_DATA_TYPE;
+}
+
+//**********************************************************************************************************************
+typedef struct ConfItemsState
+{
+	ConfItem* items;
+	char* buffer;
+	char* arena;
+	uint64_t* sectionOffsets;
+	const char* data;
+	size_t itemCount;
+	size_t itemCapacity;
+	size_t bufferCapacity;
+	size_t arenaSize;
+	size_t arenaCapacity;
+	size_t sectionCount;
+	size_t sectionCapacity;
+	uint64_t sectionOffset;
+	size_t sectionSize;
+	size_t lineIndex;
+	bool isBorrowed;
+} ConfItemsState;
+
+inline static ConfResult initConfItemsState(ConfItemsState* state,
+	const char* data, size_t arenaCapacity, bool isBorrowed)
+{
+	assert(state != NULL);
+	memset(state, 0, sizeof(ConfItemsState));
+
+	state->items = malloc(sizeof(struct ConfItem));
+	if (!state->items)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	state->buffer = malloc(sizeof(char));
+	if (!state->buffer)
+	{
+		free(state->items);
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	if (!isBorrowed)
+	{
+		state->arena = malloc(arenaCapacity * sizeof(char));
+		if (!state->arena)
+		{
+			free(state->buffer); free(state->items);
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+		}
+	}
+
+	state->data = data;
+	state->itemCapacity = 1;
+	state->bufferCapacity = 1;
+	state->arenaCapacity = isBorrowed ? 0 : arenaCapacity;
+	state->isBorrowed = isBorrowed;
+	return SUCCESS_CONF_RESULT;
+}
+inline static void destroyConfItemsState(ConfItemsState* state)
+{
+	assert(state != NULL);
+	free(state->sectionOffsets);
+	free(state->arena);
+	free(state->buffer);
+	free(state->items);
+}
+
+//**********************************************************************************************************************
+inline static ConfResult splitConfItemLine(const char* line, size_t lineSize,
+	size_t separatorIndex, size_t sectionSize, const char** value, size_t* valueSize)
+{
+	if (separatorIndex >= lineSize)
+		return BAD_ITEM_CONF_RESULT;
+	if (separatorIndex == 0 || separatorIndex > UINT32_MAX - sectionSize)
+		return BAD_KEY_CONF_RESULT;
+
+	const char* itemValue = line + separatorIndex + 1;
+	size_t itemValueSize = lineSize - (separatorIndex + 1);
+
+	if (itemValueSize <= 1 || itemValue[0] != ' ')
+		return BAD_VALUE_CONF_RESULT;
+
+	*value = itemValue + 1;
+	*valueSize = itemValueSize - 1;
+	return SUCCESS_CONF_RESULT;
+}
+
+inline static ConfResult parseConfSection(ConfItemsState* state, const char* line, size_t lineSize)
+{
+	// Note: keys are stored with the section prefix, so sections are prefix ranges of the sorted items.
+	if (state->isBorrowed)
+		return OWNED_DATA_CONF_RESULT;
+
+	size_t sectionSize = lineSize - 2;
+	if (sectionSize == 0 || sectionSize >= UINT32_MAX)
+		return BAD_KEY_CONF_RESULT;
+
+	if (state->sectionCount == state->sectionCapacity)
+	{
+		size_t sectionCapacity = state->sectionCapacity > 0 ? state->sectionCapacity * 2 : 4;
+		uint64_t* sectionOffsets = realloc(state->sectionOffsets, sectionCapacity * sizeof(uint64_t));
+		if (!sectionOffsets)
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+		state->sectionOffsets = sectionOffsets;
+		state->sectionCapacity = sectionCapacity;
+	}
+
+	if (!appendConfData(&state->arena, &state->arenaSize, &state->arenaCapacity,
+		line + 1, sectionSize, &state->sectionOffset))
+	{
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	state->arena[state->arenaSize - 1] = '.';
+	if (!reserveConfData(&state->arena, state->arenaSize, &state->arenaCapacity, 1))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	state->arena[state->arenaSize++] = '\0';
+
+	state->sectionSize = sectionSize + 1;
+	state->sectionOffsets[state->sectionCount++] = state->sectionOffset;
+	return SUCCESS_CONF_RESULT;
+}
+
+/*
+ * Parses one config line without the new line symbol. Line should be inside the state data if it's borrowed.
+ */
+inline static ConfResult parseConfLine(ConfItemsState* state, const char* line, size_t lineSize, size_t separatorIndex)
+{
+	assert(state != NULL);
+	assert(line != NULL || lineSize == 0);
+
+	while (lineSize > 0 && line[lineSize - 1] == '\r')
+		lineSize--;
+
+	if (lineSize == 0 || line[0] == '#')
+		return SUCCESS_CONF_RESULT;
+
+	if (line[0] == '[' && separatorIndex >= lineSize && line[lineSize - 1] == ']')
+		return parseConfSection(state, line, lineSize);
+
+	size_t keySize = separatorIndex, sectionSize = state->sectionSize;
+	const char* value; size_t valueSize;
+	ConfResult confResult = splitConfItemLine(line, lineSize, separatorIndex, sectionSize, &value, &valueSize);
+	if (confResult != SUCCESS_CONF_RESULT)
+		return confResult;
+
+	// Note: one extra byte is reserved for the value parsing terminator.
+	if (!reserveConfData(&state->buffer, 0, &state->bufferCapacity, valueSize + 1))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	size_t lineIndex = state->lineIndex;
+	ConfItem item;
+	item.keySize = (uint32_t)(sectionSize + keySize);
+	item.line = lineIndex < UINT32_MAX ? (uint32_t)(lineIndex + 1) : UINT32_MAX;
+	parseConfValue(value, valueSize, state->buffer, &item);
+
+	if (state->isBorrowed)
+	{
+		item.keyOffset = line - state->data;
+		if (item.type == STRING_CONF_DATA_TYPE)
+		{
+			item.value.string.offset = value - state->data;
+			item.value.string.length = valueSize;
+		}
+	}
+	else
+	{
+		bool result = sectionSize > 0 ? appendConfSectionKey(&state->arena, &state->arenaSize,
+			&state->arenaCapacity, state->sectionOffset, sectionSize, line, keySize, &item.keyOffset) :
+			appendConfData(&state->arena, &state->arenaSize, &state->arenaCapacity, line, keySize, &item.keyOffset);
+		if (result && item.type == STRING_CONF_DATA_TYPE)
+		{
+			item.value.string.length = valueSize;
+			result = appendConfData(&state->arena, &state->arenaSize,
+				&state->arenaCapacity, value, valueSize, &item.value.string.offset);
+		}
+
+		if (!result)
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	if (state->itemCount == state->itemCapacity)
+	{
+		size_t itemCapacity = state->itemCapacity * 2;
+		ConfItem* items = realloc(state->items, itemCapacity * sizeof(struct ConfItem));
+		if (!items)
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+		state->items = items;
+		state->itemCapacity = itemCapacity;
+	}
+
+	state->items[state->itemCount++] = item;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+inline static int compareConfSections(const void* a, const void* b)
+{
+	const ConfSection* sectionA = (const ConfSection*)a;
+	const ConfSection* sectionB = (const ConfSection*)b;
+	return compareConfKeys(sectionA->name, sectionA->nameSize, sectionB->name, sectionB->nameSize);
+}
+
+/*
+ * Sorts parsed items, builds section views and moves state memory to the reader. State is destroyed.
+ * First line is set only for the repeating keys, to the line of the first item with the same key.
+ */
+inline static ConfResult finishConfItems(ConfItemsState* state,
+	ConfReader confReader, size_t* errorLine, size_t* firstLine)
+{
+	assert(state != NULL);
+	assert(confReader != NULL);
+
+	free(state->buffer);
+	state->buffer = NULL;
+
+	ConfItem* items = state->items;
+	size_t itemCount = state->itemCount;
+	bool isBorrowed = state->isBorrowed;
+
+	if (itemCount > 0)
+	{
+		ConfItem* sortBuffer = malloc(itemCount * sizeof(struct ConfItem));
+		if (!sortBuffer)
+		{
+			destroyConfItemsState(state);
+			if (errorLine)
+				*errorLine = 0;
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+		}
+
+		size_t repeatLine, repeatFirstLine;
+		bool result = sortConfItems(items, sortBuffer, itemCount,
+			isBorrowed ? state->data : state->arena, &repeatLine, &repeatFirstLine);
+		free(sortBuffer);
+
+		if (!result)
+		{
+			destroyConfItemsState(state);
+			if (errorLine)
+				*errorLine = repeatLine;
+			if (firstLine)
+				*firstLine = repeatFirstLine;
+			return REPEATING_KEYS_CONF_RESULT;
+		}
+
+		// Note: shrinking to fit, items and arena are not modified after parsing.
+		ConfItem* newItems = realloc(items, itemCount * sizeof(struct ConfItem));
+		if (newItems)
+			items = newItems;
+	}
+	else
+	{
+		free(items);
+		items = NULL;
+	}
+	state->items = NULL;
+
+	char* arena = state->arena;
+	if (!isBorrowed)
+	{
+		if (state->arenaSize > 0)
+		{
+			char* newArena = realloc(arena, state->arenaSize * sizeof(char));
+			if (newArena)
+				arena = newArena;
+		}
+		else
+		{
+			free(arena);
+			arena = NULL;
+		}
+	}
+	state->arena = NULL;
+
+	size_t sectionCount = state->sectionCount;
+	ConfSection* sections = NULL;
+
+	if (sectionCount > 0)
+	{
+		sections = malloc(sectionCount * sizeof(ConfSection));
+		if (!sections)
+		{
+			free(state->sectionOffsets); free(arena); free(items);
+			if (errorLine)
+				*errorLine = 0;
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+		}
+
+		for (size_t i = 0; i < sectionCount; i++)
+		{
+			ConfSection* section = &sections[i];
+			section->name = arena + state->sectionOffsets[i];
+			section->nameSize = strlen(section->name) - 1;
+		}
+
+		// Note: the same section can be declared multiple times.
+		qsort(sections, sectionCount, sizeof(ConfSection), compareConfSections);
+		size_t uniqueCount = 1;
+		for (size_t i = 1; i < sectionCount; i++)
+		{
+			if (compareConfSections(&sections[uniqueCount - 1], &sections[i]) != 0)
+				sections[uniqueCount++] = sections[i];
+		}
+		sectionCount = uniqueCount;
+	}
+	free(state->sectionOffsets);
+	state->sectionOffsets = NULL;
+
+	confReader->items = items;
+	confReader->data = isBorrowed ? (char*)state->data : arena;
+	confReader->hashSlots = NULL;
+	confReader->sections = sections;
+	confReader->itemCount = itemCount;
+	confReader->hashMask = 0;
+	confReader->hashSeed = 0;
+	confReader->sectionCount = sectionCount;
+	confReader->keySkip = 0;
+	confReader->dataSize = isBorrowed ? 0 : state->arenaSize;
+	confReader->image = NULL;
+	confReader->imageSize = 0;
+	confReader->isBorrowed = isBorrowed;
+	confReader->isView = false;
+	confReader->isHashMapped = false;
+
+	for (size_t i = 0; i < sectionCount; i++)
+	{
+		ConfSection* section = &sections[i];
+		size_t first, count;
+		findConfReaderPrefix(confReader, section->name, section->nameSize + 1, &first, &count);
+
+		ConfReader_T* view = &section->view;
+		view->items = items ? items + first : NULL;
+		view->data = arena;
+		view->hashSlots = NULL;
+		view->sections = NULL;
+		view->itemCount = count;
+		view->hashMask = 0;
+		view->hashSeed = 0;
+		view->sectionCount = 0;
+		view->keySkip = section->nameSize + 1;
+		view->dataSize = 0;
+		view->image = NULL;
+		view->imageSize = 0;
+		view->isBorrowed = true;
+		view->isView = true;
+		view->isHashMapped = false;
+	}
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+inline static ConfResult createConfItems(const char* data, size_t size,
+	bool isBorrowed, ConfReader confReader, size_t* errorLine, size_t* firstLine)
+{
+	assert(data != NULL || size == 0);
+	assert(confReader != NULL);
+
+	// Note: owned keys and values with terminators never take more space than the source lines. (without sections)
+	ConfItemsState state;
+	ConfResult confResult = initConfItemsState(&state, data, size + 1, isBorrowed);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return confResult;
+	}
+
+	ScanConfLine scanConfLine = getConfLineScanner();
+	size_t offset = 0;
+
+	while (offset < size)
+	{
+		const char* line = data + offset;
+		size_t separatorIndex;
+		size_t lineSize = scanConfLine(line, size - offset, &separatorIndex);
+		offset += lineSize + 1;
+
+		confResult = parseConfLine(&state, line, lineSize, separatorIndex);
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			destroyConfItemsState(&state);
+			if (confResult == OWNED_DATA_CONF_RESULT)
+				return createConfItems(data, size, false, confReader, errorLine, firstLine);
+			if (errorLine)
+				*errorLine = state.lineIndex + 1;
+			return confResult;
+		}
+		state.lineIndex++;
+	}
+
+	return finishConfItems(&state, confReader, errorLine, firstLine);
+}
+
+//**********************************************************************************************************************
+// Note: set keys point to the source data, section keys are stored as a section and key pair.
+typedef struct ConfSetKey
+{
+	const char* section;
+	const char* key;
+	uint64_t hash;
+	uint32_t sectionSize;
+	uint32_t keySize;
+} ConfSetKey;
+typedef struct ConfKeySet
+{
+	ConfHashSlot* slots;
+	ConfSetKey* keys;
+	size_t slotMask;
+	size_t keyCount;
+	uint64_t seed;
+} ConfKeySet;
+
+inline static bool growConfKeySet(ConfKeySet* keySet)
+{
+	// Note: keeping load factor at or below 0.5 for short linear probes.
+	size_t slotCount = keySet->slots ? (keySet->slotMask + 1) * 2 : 64;
+	if (slotCount > UINT32_MAX || slotCount > SIZE_MAX / (sizeof(ConfHashSlot) + sizeof(ConfSetKey)))
+		return false;
+
+	ConfSetKey* keys = realloc(keySet->keys, (slotCount / 2) * sizeof(ConfSetKey));
+	if (!keys)
+		return false;
+	keySet->keys = keys;
+
+	ConfHashSlot* slots = calloc(slotCount, sizeof(ConfHashSlot));
+	if (!slots)
+		return false;
+
+	size_t slotMask = slotCount - 1;
+	for (size_t i = 0; i < keySet->keyCount; i++)
+	{
+		uint64_t hash = keys[i].hash;
+		size_t slotIndex = (size_t)hash & slotMask;
+		while (slots[slotIndex].index != 0)
+			slotIndex = (slotIndex + 1) & slotMask;
+		slots[slotIndex].hash = (uint32_t)(hash >> 32);
+		slots[slotIndex].index = (uint32_t)(i + 1);
+	}
+
+	free(keySet->slots);
+	keySet->slots = slots;
+	keySet->slotMask = slotMask;
+	return true;
+}
+inline static bool isConfSetKeyEqual(const ConfSetKey* setKey, const char* key, size_t keySize)
+{
+	size_t sectionSize = setKey->sectionSize;
+	if (sectionSize == 0)
+		return setKey->keySize == keySize && memcmp(setKey->key, key, keySize) == 0;
+
+	return sectionSize + 1 + setKey->keySize == keySize && memcmp(setKey->section, key, sectionSize) == 0 &&
+		key[sectionSize] == '.' && memcmp(setKey->key, key + sectionSize + 1, setKey->keySize) == 0;
+}
+/*
+ * Adds "section.key" to the set. Returns success, repeating keys or allocation failure result.
+ */
+inline static ConfResult insertConfKeySet(ConfKeySet* keySet, const char* section,
+	size_t sectionSize, const char* key, size_t keySize, const char* fullKey, size_t fullKeySize)
+{
+	if (!keySet->slots || keySet->keyCount * 2 >= keySet->slotMask + 1)
+	{
+		if (!growConfKeySet(keySet))
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	uint64_t hash = hashConfKey(fullKey, fullKeySize, keySet->seed);
+	uint32_t slotHash = (uint32_t)(hash >> 32);
+	ConfHashSlot* slots = keySet->slots;
+	size_t slotMask = keySet->slotMask, slotIndex = (size_t)hash & slotMask;
+
+	while (slots[slotIndex].index != 0)
+	{
+		const ConfHashSlot* slot = &slots[slotIndex];
+		if (slot->hash == slotHash && isConfSetKeyEqual(&keySet->keys[slot->index - 1], fullKey, fullKeySize))
+			return REPEATING_KEYS_CONF_RESULT;
+		slotIndex = (slotIndex + 1) & slotMask;
+	}
+
+	ConfSetKey* setKey = &keySet->keys[keySet->keyCount];
+	setKey->section = section;
+	setKey->key = key;
+	setKey->hash = hash;
+	setKey->sectionSize = (uint32_t)sectionSize;
+	setKey->keySize = (uint32_t)keySize;
+
+	slots[slotIndex].hash = slotHash;
+	slots[slotIndex].index = (uint32_t)(++keySet->keyCount);
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+typedef struct ConfStreamState
+{
+	OnConfItem onItem;
+	void* context;
+	char* buffer;
+	char* key;
+	const char* section;
+	ConfKeySet* keySet;
+	size_t bufferCapacity;
+	size_t keyCapacity;
+	size_t sectionSize;
+} ConfStreamState;
+
+inline static ConfResult streamConfLine(ConfStreamState* state, const char* line,
+	size_t lineSize, size_t separatorIndex, size_t lineIndex)
+{
+	while (lineSize > 0 && line[lineSize - 1] == '\r')
+		lineSize--;
+
+	if (lineSize == 0 || line[0] == '#')
+		return SUCCESS_CONF_RESULT;
+
+	if (line[0] == '[' && separatorIndex >= lineSize && line[lineSize - 1] == ']')
+	{
+		size_t sectionSize = lineSize - 2;
+		if (sectionSize == 0 || sectionSize >= UINT32_MAX)
+			return BAD_KEY_CONF_RESULT;
+		if (!reserveConfData(&state->key, 0, &state->keyCapacity, sectionSize + 1))
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+		memcpy(state->key, line + 1, sectionSize);
+		state->key[sectionSize] = '.';
+		state->section = line + 1;
+		state->sectionSize = sectionSize + 1;
+		return SUCCESS_CONF_RESULT;
+	}
+
+	size_t sectionSize = state->sectionSize;
+	const char* value; size_t valueSize;
+	ConfResult confResult = splitConfItemLine(line, lineSize, separatorIndex, sectionSize, &value, &valueSize);
+	if (confResult != SUCCESS_CONF_RESULT)
+		return confResult;
+
+	// Note: one extra byte is reserved for the value parsing terminator.
+	if (!reserveConfData(&state->buffer, 0, &state->bufferCapacity, valueSize + 1))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	const char* key = line;
+	size_t keySize = separatorIndex;
+
+	// Note: only section keys are composed, others point to the source data.
+	if (sectionSize > 0)
+	{
+		if (!reserveConfData(&state->key, sectionSize, &state->keyCapacity, keySize))
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+		memcpy(state->key + sectionSize, key, keySize);
+		key = state->key;
+		keySize += sectionSize;
+	}
+
+	if (state->keySet)
+	{
+		confResult = insertConfKeySet(state->keySet, state->section, sectionSize > 0 ? sectionSize - 1 : 0,
+			line, separatorIndex, key, keySize);
+		if (confResult != SUCCESS_CONF_RESULT)
+			return confResult;
+	}
+
+	ConfItem item;
+	parseConfValue(value, valueSize, state->buffer, &item);
+
+	ConfItemValue itemValue;
+	switch (item.type)
+	{
+	case INTEGER_CONF_DATA_TYPE:
+		itemValue.integer = item.value.integer;
+		break;
+	case FLOATING_CONF_DATA_TYPE:
+		itemValue.floating = item.value.floating;
+		break;
+	case BOOLEAN_CONF_DATA_TYPE:
+		itemValue.boolean = item.value.boolean;
+		break;
+	case STRING_CONF_DATA_TYPE:
+		itemValue.string.data = value;
+		itemValue.string.length = valueSize;
+		break;
+	default:
+		assert(false); // Unknown Conf data type.
+		return BAD_VALUE_CONF_RESULT;
+	}
+
+	state->onItem(key, keySize, item.type, &itemValue, lineIndex + 1, state->context);
+	return SUCCESS_CONF_RESULT;
+}
+
+inline static ConfResult streamConfItems(const char* data, size_t size, OnConfItem onItem,
+	void* context, bool checkRepeats, size_t* errorLine)
+{
+	assert(data != NULL || size == 0);
+	assert(onItem != NULL);
+
+	ConfKeySet keySet;
+	memset(&keySet, 0, sizeof(ConfKeySet));
+	if (checkRepeats)
+		keySet.seed = getConfRandomSeed(data); // Note: prevents hash flooding with untrusted configs.
+
+	ConfStreamState state;
+	memset(&state, 0, sizeof(ConfStreamState));
+	state.onItem = onItem;
+	state.context = context;
+	state.keySet = checkRepeats ? &keySet : NULL;
+
+	ScanConfLine scanConfLine = getConfLineScanner();
+	size_t offset = 0, lineIndex = 0;
+	ConfResult confResult = SUCCESS_CONF_RESULT;
+
+	while (offset < size)
+	{
+		const char* line = data + offset;
+		size_t separatorIndex;
+		size_t lineSize = scanConfLine(line, size - offset, &separatorIndex);
+		offset += lineSize + 1;
+
+		confResult = streamConfLine(&state, line, lineSize, separatorIndex, lineIndex);
+		if (confResult != SUCCESS_CONF_RESULT)
+			break;
+		lineIndex++;
+	}
+
+	free(keySet.keys); free(keySet.slots);
+	free(state.key); free(state.buffer);
+
+	if (errorLine)
+		*errorLine = confResult != SUCCESS_CONF_RESULT ? lineIndex + 1 : 0;
+	return confResult;
+}
+
+//**********************************************************************************************************************
+inline static ConfResult readConfFile(FILE* file, char** _data, size_t* _size)
+{
+	assert(file != NULL);
+	assert(_data != NULL);
+	assert(_size != NULL);
+
+	// Note: file size is only a hint, we still read until the end to support pipes.
+	size_t capacity = 1;
+	if (seekFile(file, 0, SEEK_END) == 0)
+	{
+		int64_t fileSize = tellFile(file);
+		if (fileSize > 0 && (uint64_t)fileSize < SIZE_MAX)
+			capacity = (size_t)fileSize + 1;
+		if (seekFile(file, 0, SEEK_SET) != 0)
+			return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+
+	char* data = malloc(capacity * sizeof(char));
+	if (!data)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	size_t size = 0;
+	while (true)
+	{
+		size += fread(data + size, sizeof(char), capacity - size, file);
+		if (size < capacity)
+			break;
+
+		capacity *= 2;
+		char* newData = realloc(data, capacity * sizeof(char));
+		if (!newData)
+		{
+			free(data);
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+		}
+		data = newData;
+	}
+
+	if (ferror(file) != 0)
+	{
+		free(data);
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+
+	*_data = data;
+	*_size = size;
+	return SUCCESS_CONF_RESULT;
+}
+inline static ConfResult mapConfImage(const char* filePath, void** _image, size_t* _imageSize)
+{
+	assert(filePath != NULL);
+	assert(_image != NULL);
+	assert(_imageSize != NULL);
+
+	#if _WIN32
+	HANDLE file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ,
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize))
+	{
+		CloseHandle(file);
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+	if (fileSize.QuadPart < (LONGLONG)sizeof(ConfImageHeader) || (uint64_t)fileSize.QuadPart > SIZE_MAX)
+	{
+		CloseHandle(file);
+		return BAD_IMAGE_CONF_RESULT;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!mapping)
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+
+	void* image = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+	if (!image)
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	size_t imageSize = (size_t)fileSize.QuadPart;
+	#else
+	int file = open(filePath, O_RDONLY | O_CLOEXEC);
+	if (file < 0)
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+
+	struct stat fileStatus;
+	if (fstat(file, &fileStatus) != 0)
+	{
+		close(file);
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+	if (fileStatus.st_size < (off_t)sizeof(ConfImageHeader) || (uint64_t)fileStatus.st_size > SIZE_MAX)
+	{
+		close(file);
+		return BAD_IMAGE_CONF_RESULT;
+	}
+
+	size_t imageSize = (size_t)fileStatus.st_size;
+	void* image = mmap(NULL, imageSize, PROT_READ, MAP_PRIVATE, file, 0);
+	close(file);
+	if (image == MAP_FAILED)
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	#endif
+
+	*_image = image;
+	*_imageSize = imageSize;
+	return SUCCESS_CONF_RESULT;
+}
+inline static void unmapConfImage(void* image, size_t imageSize)
+{
+	#if _WIN32
+	(void)imageSize;
+	UnmapViewOfFile(image);
+	#else
+	munmap(image, imageSize);
+	#endif
+}
+
+//**********************************************************************************************************************
+ConfResult createFileConfReader(const char* filePath, ConfReader* confReader, size_t* errorLine)
+{
+	return createFileConfReaderEx(filePath, confReader, errorLine, NULL);
+}
+ConfResult createFileConfReaderEx(const char* filePath, ConfReader* confReader, size_t* errorLine, size_t* firstLine)
+{
+	assert(filePath != NULL);
+	assert(confReader != NULL);
+
+	if (firstLine)
+		*firstLine = 0;
+
+	ConfReader confReaderInstance = malloc(sizeof(ConfReader_T));
+	if (!confReaderInstance)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	FILE* file = openFile(filePath, "rb");
+	if (!file)
+	{
+		free(confReaderInstance);
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+
+	char* data; size_t size;
+	ConfResult result = readConfFile(file, &data, &size);
+	closeFile(file);
+
+	if (result != SUCCESS_CONF_RESULT)
+	{
+		free(confReaderInstance);
+		if (errorLine)
+			*errorLine = 0;
+		return result;
+	}
+
+	// Note: file data was always read until the first null terminator.
+	const char* terminator = size > 0 ? memchr(data, '\0', size) : NULL;
+	if (terminator)
+		size = terminator - data;
+
+	result = createConfItems(data, size, false, confReaderInstance, errorLine, firstLine);
+	free(data);
+
+	if (result != SUCCESS_CONF_RESULT)
+	{
+		free(confReaderInstance);
+		return result;
+	}
+
+	*confReader = confReaderInstance;
+	if (errorLine)
+		*errorLine = 0;
+	return SUCCESS_CONF_RESULT;
+}
+
+ConfResult createDataConfReader(const char* data, ConfReader* confReader, size_t* errorLine)
+{
+	assert(data != NULL);
+	assert(confReader != NULL);
+	assert(errorLine != NULL);
+	return createDataConfReaderN(data, strlen(data), confReader, errorLine);
+}
+ConfResult createDataConfReaderN(const char* data, size_t size, ConfReader* confReader, size_t* errorLine)
+{
+	return createDataConfReaderEx(data, size, confReader, errorLine, NULL);
+}
+ConfResult createDataConfReaderEx(const char* data, size_t size,
+	ConfReader* confReader, size_t* errorLine, size_t* firstLine)
+{
+	assert(data != NULL || size == 0);
+	assert(confReader != NULL);
+
+	if (firstLine)
+		*firstLine = 0;
+
+	ConfReader confReaderInstance = malloc(sizeof(ConfReader_T));
+	if (!confReaderInstance)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	ConfResult result = createConfItems(data, size,
+		false, confReaderInstance, errorLine, firstLine);
+
+	if (result != SUCCESS_CONF_RESULT)
+	{
+		free(confReaderInstance);
+		return result;
+	}
+
+	*confReader = confReaderInstance;
+	if (errorLine)
+		*errorLine = 0;
+	return SUCCESS_CONF_RESULT;
+}
+
+ConfResult createBorrowedDataConfReader(const char* data, size_t size, ConfReader* confReader, size_t* errorLine)
+{
+	assert(data != NULL || size == 0);
+	assert(confReader != NULL);
+
+	ConfReader confReaderInstance = malloc(sizeof(ConfReader_T));
+	if (!confReaderInstance)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	ConfResult result = createConfItems(data, size,
+		true, confReaderInstance, errorLine, NULL);
+
+	if (result != SUCCESS_CONF_RESULT)
+	{
+		free(confReaderInstance);
+		return result;
+	}
+
+	*confReader = confReaderInstance;
+	if (errorLine)
+		*errorLine = 0;
+	return confReaderInstance->isBorrowed ? SUCCESS_CONF_RESULT : OWNED_DATA_CONF_RESULT;
+}
+
+void destroyConfReader(ConfReader confReader)
+{
+	if (!confReader || confReader->isView)
+		return;
+	if (!confReader->isBorrowed)
+		free(confReader->data);
+	for (size_t i = 0; i < confReader->sectionCount; i++)
+		free(confReader->sections[i].view.hashSlots);
+	free(confReader->sections);
+	if (!confReader->isHashMapped)
+		free(confReader->hashSlots);
+	if (confReader->image)
+		unmapConfImage(confReader->image, confReader->imageSize);
+	else
+		free(confReader->items);
+	free(confReader);
+}
+
+bool isConfReaderBorrowed(ConfReader confReader)
+{
+	assert(confReader != NULL);
+	return isConfDataBorrowed(confReader);
+}
+
+//**********************************************************************************************************************
+struct ConfParser_T
+{
+	ConfItemsState state;
+	char* line;
+	size_t lineSize;
+	size_t lineCapacity;
+	size_t errorLine;
+	ScanConfLine scanConfLine;
+	ConfResult result;
+};
+
+ConfResult createConfParser(ConfParser* confParser)
+{
+	assert(confParser != NULL);
+
+	ConfParser confParserInstance = calloc(1, sizeof(ConfParser_T));
+	if (!confParserInstance)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	confParserInstance->scanConfLine = getConfLineScanner();
+	*confParser = confParserInstance;
+	return SUCCESS_CONF_RESULT;
+}
+void destroyConfParser(ConfParser confParser)
+{
+	if (!confParser)
+		return;
+	if (confParser->state.items)
+		destroyConfItemsState(&confParser->state);
+	free(confParser->line);
+	free(confParser);
+}
+
+inline static ConfResult appendConfParserLine(ConfParser confParser, const char* data, size_t size)
+{
+	size_t lineSize = confParser->lineSize;
+	if (size == 0)
+		return SUCCESS_CONF_RESULT;
+	if (size > SIZE_MAX - lineSize)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	if (lineSize + size > confParser->lineCapacity)
+	{
+		size_t lineCapacity = confParser->lineCapacity > 0 ? confParser->lineCapacity : 64;
+		while (lineSize + size > lineCapacity)
+			lineCapacity = lineCapacity <= SIZE_MAX / 2 ? lineCapacity * 2 : lineSize + size;
+
+		char* line = realloc(confParser->line, lineCapacity * sizeof(char));
+		if (!line)
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+		confParser->line = line;
+		confParser->lineCapacity = lineCapacity;
+	}
+
+	memcpy(confParser->line + lineSize, data, size);
+	confParser->lineSize = lineSize + size;
+	return SUCCESS_CONF_RESULT;
+}
+inline static ConfResult parseConfParserLine(ConfParser confParser, const char* line, size_t lineSize, size_t separatorIndex)
+{
+	ConfItemsState* state = &confParser->state;
+	ConfResult confResult = parseConfLine(state, line, lineSize, separatorIndex);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		confParser->result = confResult;
+		confParser->errorLine = state->lineIndex + 1;
+		return confResult;
+	}
+
+	state->lineIndex++;
+	return SUCCESS_CONF_RESULT;
+}
+inline static ConfResult parsePendingConfLine(ConfParser confParser)
+{
+	const char* line = confParser->line;
+	size_t lineSize = confParser->lineSize;
+	const char* separator = lineSize > 0 ? memchr(line, ':', lineSize) : NULL;
+	size_t separatorIndex = separator ? (size_t)(separator - line) : lineSize;
+	confParser->lineSize = 0;
+	return parseConfParserLine(confParser, line, lineSize, separatorIndex);
+}
+
+ConfResult feedConfParser(ConfParser confParser, const char* data, size_t size, size_t* errorLine)
+{
+	assert(confParser != NULL);
+	assert(data != NULL || size == 0);
+
+	if (confParser->result == SUCCESS_CONF_RESULT && !confParser->state.items)
+	{
+		// Note: arena grows with the parsed items, source data is not known in advance.
+		confParser->result = initConfItemsState(&confParser->state, NULL, 64, false);
+		confParser->errorLine = 0;
+	}
+	if (confParser->result != SUCCESS_CONF_RESULT)
+	{
+		if (errorLine)
+			*errorLine = confParser->errorLine;
+		return confParser->result;
+	}
+
+	size_t offset = 0;
+	if (confParser->lineSize > 0)
+	{
+		const char* newLine = size > 0 ? memchr(data, '\n', size) : NULL;
+		size_t partSize = newLine ? (size_t)(newLine - data) : size;
+
+		ConfResult confResult = appendConfParserLine(confParser, data, partSize);
+		if (confResult == SUCCESS_CONF_RESULT && newLine)
+			confResult = parsePendingConfLine(confParser);
+		else if (confResult != SUCCESS_CONF_RESULT)
+			confParser->result = confResult;
+
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			if (errorLine)
+				*errorLine = confParser->errorLine;
+			return confResult;
+		}
+
+		if (!newLine)
+		{
+			if (errorLine)
+				*errorLine = 0;
+			return SUCCESS_CONF_RESULT;
+		}
+		offset = partSize + 1;
+	}
+
+	ScanConfLine scanConfLine = confParser->scanConfLine;
+	while (offset < size)
+	{
+		const char* line = data + offset;
+		size_t separatorIndex;
+		size_t lineSize = scanConfLine(line, size - offset, &separatorIndex);
+
+		// Note: keeping only the unfinished line, so memory is bounded by the longest line.
+		ConfResult confResult;
+		if (offset + lineSize == size)
+		{
+			confResult = appendConfParserLine(confParser, line, lineSize);
+			if (confResult != SUCCESS_CONF_RESULT)
+				confParser->result = confResult;
+		}
+		else
+		{
+			confResult = parseConfParserLine(confParser, line, lineSize, separatorIndex);
+		}
+
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			if (errorLine)
+				*errorLine = confParser->errorLine;
+			return confResult;
+		}
+		offset += lineSize + 1;
+	}
+
+	if (errorLine)
+		*errorLine = 0;
+	return SUCCESS_CONF_RESULT;
+}
+
+ConfResult finishConfParser(ConfParser confParser, ConfReader* confReader, size_t* errorLine)
+{
+	assert(confParser != NULL);
+	assert(confReader != NULL);
+
+	ConfResult confResult = feedConfParser(confParser, NULL, 0, errorLine);
+	if (confResult == SUCCESS_CONF_RESULT && confParser->lineSize > 0)
+	{
+		confResult = parsePendingConfLine(confParser);
+		if (errorLine)
+			*errorLine = confParser->errorLine;
+	}
+
+	ConfReader confReaderInstance = NULL;
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		confReaderInstance = malloc(sizeof(ConfReader_T));
+		if (!confReaderInstance)
+		{
+			if (errorLine)
+				*errorLine = 0;
+			confResult = FAILED_TO_ALLOCATE_CONF_RESULT;
+		}
+	}
+
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		// Note: finishing moves state memory to the reader.
+		confResult = finishConfItems(&confParser->state, confReaderInstance, errorLine, NULL);
+		if (confResult != SUCCESS_CONF_RESULT)
+			free(confReaderInstance);
+	}
+	else if (confParser->state.items)
+	{
+		destroyConfItemsState(&confParser->state);
+	}
+
+	// Note: parser is reset and can be reused for the next config.
+	memset(&confParser->state, 0, sizeof(ConfItemsState));
+	confParser->lineSize = 0;
+	confParser->errorLine = 0;
+	confParser->result = SUCCESS_CONF_RESULT;
+
+	if (confResult != SUCCESS_CONF_RESULT)
+		return confResult;
+
+	*confReader = confReaderInstance;
+	if (errorLine)
+		*errorLine = 0;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+ConfResult parseConfData(const char* data, size_t size, OnConfItem onItem,
+	void* context, bool checkRepeats, size_t* errorLine)
+{
+	assert(data != NULL || size == 0);
+	assert(onItem != NULL);
+	return streamConfItems(data, size, onItem, context, checkRepeats, errorLine);
+}
+ConfResult parseConfFile(const char* filePath, OnConfItem onItem,
+	void* context, bool checkRepeats, size_t* errorLine)
+{
+	assert(filePath != NULL);
+	assert(onItem != NULL);
+
+	FILE* file = openFile(filePath, "rb");
+	if (!file)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+
+	char* data; size_t size;
+	ConfResult result = readConfFile(file, &data, &size);
+	closeFile(file);
+
+	if (result != SUCCESS_CONF_RESULT)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return result;
+	}
+
+	// Note: file data was always read until the first null terminator.
+	const char* terminator = size > 0 ? memchr(data, '\0', size) : NULL;
+	if (terminator)
+		size = terminator - data;
+
+	result = streamConfItems(data, size, onItem, context, checkRepeats, errorLine);
+	free(data);
+	return result;
+}
+
+ConfResult buildConfReaderHashIndex(ConfReader confReader, uint64_t seed)
+{
+	assert(confReader != NULL);
+
+	size_t itemCount = confReader->itemCount;
+	if (itemCount >= UINT32_MAX || itemCount > SIZE_MAX / (sizeof(ConfHashSlot) * 4))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	// Note: keeping load factor at or below 0.5 for short linear probes.
+	size_t slotCount = 2;
+	while (slotCount < itemCount * 2)
+		slotCount *= 2;
+
+	ConfHashSlot* hashSlots = calloc(slotCount, sizeof(ConfHashSlot));
+	if (!hashSlots)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	const ConfItem* items = confReader->items;
+	const char* data = confReader->data + confReader->keySkip;
+	size_t hashMask = slotCount - 1, keySkip = confReader->keySkip;
+
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		const ConfItem* item = &items[i];
+		uint64_t hash = hashConfKey(data + item->keyOffset, item->keySize - keySkip, seed);
+
+		size_t slot = (size_t)hash & hashMask;
+		while (hashSlots[slot].index != 0)
+			slot = (slot + 1) & hashMask;
+
+		hashSlots[slot].hash = (uint32_t)(hash >> 32);
+		hashSlots[slot].index = (uint32_t)(i + 1);
+	}
+
+	if (!confReader->isHashMapped)
+		free(confReader->hashSlots);
+	confReader->hashSlots = hashSlots;
+	confReader->isHashMapped = false;
+	confReader->hashMask = hashMask;
+	confReader->hashSeed = seed;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+void getConfReaderMemoryUsage(ConfReader confReader, ConfMemoryUsage* memoryUsage)
+{
+	assert(confReader != NULL);
+	assert(memoryUsage != NULL);
+
+	size_t sectionsSize = confReader->sectionCount * sizeof(ConfSection);
+	for (size_t i = 0; i < confReader->sectionCount; i++)
+	{
+		const ConfReader_T* view = &confReader->sections[i].view;
+		if (view->hashSlots)
+			sectionsSize += (view->hashMask + 1) * sizeof(ConfHashSlot);
+	}
+
+	memoryUsage->items = confReader->itemCount * sizeof(ConfItem);
+	memoryUsage->data = confReader->dataSize;
+	memoryUsage->hashIndex = confReader->hashSlots ? (confReader->hashMask + 1) * sizeof(ConfHashSlot) : 0;
+	memoryUsage->sections = sectionsSize;
+	memoryUsage->mapped = confReader->imageSize;
+}
+
+//**********************************************************************************************************************
+inline static bool getConfItemInt(const ConfItem* item, int64_t* value)
+{
+	if (!item || item->type != INTEGER_CONF_DATA_TYPE)
+		return false;
+
+	*value = item->value.integer;
+	return true;
+}
+inline static bool getConfItemFloat(const ConfItem* item, double* value)
+{
+	if (!item)
+		return false;
+
+	if (item->type == FLOATING_CONF_DATA_TYPE)
+	{
+		*value = item->value.floating;
+		return true;
+	}
+	else if (item->type == INTEGER_CONF_DATA_TYPE)
+	{
+		*value = item->value.integer;
+		return true;
+	}
+	return false;
+}
+inline static bool getConfItemBool(const ConfItem* item, bool* value)
+{
+	if (!item || item->type != BOOLEAN_CONF_DATA_TYPE)
+		return false;
+
+	*value = item->value.boolean;
+	return true;
+}
+inline static bool getConfItemString(ConfReader confReader,
+	const ConfItem* item, const char** value, uint64_t* length)
+{
+	if (!item || item->type != STRING_CONF_DATA_TYPE)
+		return false;
+
+	*value = confReader->data + item->value.string.offset;
+	if (length)
+		*length = item->value.string.length;
+	return true;
+}
+
+inline static bool getConfItemValue(ConfReader confReader, const ConfItem* item, const ConfLookup* lookup)
+{
+	switch (lookup->type)
+	{
+	case INTEGER_CONF_DATA_TYPE:
+		return getConfItemInt(item, (int64_t*)lookup->value);
+	case FLOATING_CONF_DATA_TYPE:
+		return getConfItemFloat(item, (double*)lookup->value);
+	case BOOLEAN_CONF_DATA_TYPE:
+		return getConfItemBool(item, (bool*)lookup->value);
+	case STRING_CONF_DATA_TYPE:
+		return getConfItemString(confReader, item, (const char**)lookup->value, lookup->length);
+	default:
+		assert(false); // Unknown Conf data type.
+		return false;
+	}
+}
+
+//**********************************************************************************************************************
+#define CONF_SMALL_BATCH_SIZE 64
+
+typedef struct ConfMatchKey
+{
+	const char* key;
+	size_t keyLength;
+	size_t index;
+} ConfMatchKey;
+
+typedef const char*(*GetConfMatchKey)(const void* requests, size_t index, size_t* keyLength);
+typedef void(*OnConfMatch)(void* context, size_t index, const ConfItem* item);
+
+inline static int compareConfMatchKeys(const void* a, const void* b)
+{
+	const ConfMatchKey* keyA = *(const ConfMatchKey* const*)a;
+	const ConfMatchKey* keyB = *(const ConfMatchKey* const*)b;
+	return compareConfKeys(keyA->key, keyA->keyLength, keyB->key, keyB->keyLength);
+}
+
+inline static size_t gallopConfItems(const ConfItem* items, size_t itemCount,
+	const char* data, size_t keySkip, size_t low, const char* key, size_t keySize)
+{
+	// Note: exponential search from the previous match, O(log distance) instead of O(log n) per key.
+	size_t high = low, step = 1;
+	while (high < itemCount)
+	{
+		const ConfItem* item = &items[high];
+		if (compareConfKeys(data + item->keyOffset, item->keySize - keySkip, key, keySize) >= 0)
+			break;
+
+		low = high + 1;
+		high += step;
+		step *= 2;
+
+		if (high < itemCount)
+			prefetchConfData(data + items[high].keyOffset);
+	}
+	if (high > itemCount)
+		high = itemCount;
+
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		const ConfItem* item = &items[middle];
+		if (compareConfKeys(data + item->keyOffset, item->keySize - keySkip, key, keySize) < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+/*
+ * Finds items for a set of requested keys, in one merge pass over the sorted items when possible.
+ * Calls onMatch for every request, with NULL item if key is not found.
+ */
+inline static void matchConfItems(ConfReader confReader, const void* requests,
+	size_t requestCount, GetConfMatchKey getMatchKey, OnConfMatch onMatch, void* context)
+{
+	assert(confReader != NULL);
+	assert(requests != NULL || requestCount == 0);
+	assert(getMatchKey != NULL);
+	assert(onMatch != NULL);
+
+	const char* key; size_t keyLength;
+	if (confReader->hashSlots)
+	{
+		for (size_t i = 0; i < requestCount; i++)
+		{
+			key = getMatchKey(requests, i, &keyLength);
+			onMatch(context, i, findConfItem(confReader, key, keyLength));
+		}
+		return;
+	}
+
+	bool isSorted = true;
+	if (requestCount > 0)
+	{
+		size_t previousLength;
+		const char* previousKey = getMatchKey(requests, 0, &previousLength);
+		for (size_t i = 1; i < requestCount; i++)
+		{
+			key = getMatchKey(requests, i, &keyLength);
+			if (compareConfKeys(previousKey, previousLength, key, keyLength) > 0)
+			{
+				isSorted = false;
+				break;
+			}
+			previousKey = key; previousLength = keyLength;
+		}
+	}
+
+	// Note: small batches are sorted on the stack, allocation costs more than sorting a few keys.
+	ConfMatchKey smallKeys[CONF_SMALL_BATCH_SIZE]; ConfMatchKey* smallOrder[CONF_SMALL_BATCH_SIZE];
+	ConfMatchKey* matchKeys = NULL; ConfMatchKey** matchOrder = NULL;
+	if (!isSorted)
+	{
+		if (requestCount <= CONF_SMALL_BATCH_SIZE)
+		{
+			matchKeys = smallKeys;
+			matchOrder = smallOrder;
+		}
+		else
+		{
+			// Note: sorting pointers, qsort moves them faster than the larger key structs.
+			matchKeys = malloc(requestCount * (sizeof(ConfMatchKey) + sizeof(ConfMatchKey*)));
+			if (matchKeys)
+				matchOrder = (ConfMatchKey**)(matchKeys + requestCount);
+		}
+	}
+
+	if (matchKeys)
+	{
+		for (size_t i = 0; i < requestCount; i++)
+		{
+			ConfMatchKey* matchKey = &matchKeys[i];
+			matchKey->key = getMatchKey(requests, i, &matchKey->keyLength);
+			matchKey->index = i;
+			matchOrder[i] = matchKey;
+		}
+
+		if (matchKeys == smallKeys)
+		{
+			for (size_t i = 1; i < requestCount; i++)
+			{
+				ConfMatchKey* matchKey = matchOrder[i]; size_t j = i;
+				for (; j > 0 && compareConfMatchKeys(&matchOrder[j - 1], &matchKey) > 0; j--)
+					matchOrder[j] = matchOrder[j - 1];
+				matchOrder[j] = matchKey;
+			}
+		}
+		else
+		{
+			qsort(matchOrder, requestCount, sizeof(ConfMatchKey*), compareConfMatchKeys);
+		}
+	}
+	else if (!isSorted)
+	{
+		// Note: out of memory, falling back to the separate binary searches.
+		for (size_t i = 0; i < requestCount; i++)
+		{
+			key = getMatchKey(requests, i, &keyLength);
+			onMatch(context, i, findConfItem(confReader, key, keyLength));
+		}
+		return;
+	}
+
+	const ConfItem* items = confReader->items;
+	const char* data = confReader->data + confReader->keySkip;
+	size_t itemCount = confReader->itemCount, keySkip = confReader->keySkip, low = 0;
+
+	for (size_t i = 0; i < requestCount; i++)
+	{
+		size_t index;
+		if (matchKeys)
+		{
+			const ConfMatchKey* matchKey = matchOrder[i];
+			key = matchKey->key; keyLength = matchKey->keyLength; index = matchKey->index;
+			if (i + 1 < requestCount)
+				prefetchConfData(matchOrder[i + 1]->key);
+		}
+		else
+		{
+			key = getMatchKey(requests, i, &keyLength); index = i;
+		}
+
+		low = gallopConfItems(items, itemCount, data, keySkip, low, key, keyLength);
+		const ConfItem* item = low < itemCount && items[low].keySize - keySkip == keyLength &&
+			memcmp(data + items[low].keyOffset, key, keyLength * sizeof(char)) == 0 ? &items[low] : NULL;
+		onMatch(context, index, item);
+	}
+
+	if (matchKeys != smallKeys)
+		free(matchKeys);
+}
+
+//**********************************************************************************************************************
+typedef struct ConfBatchContext
+{
+	ConfReader confReader;
+	const ConfLookup* lookups;
+	uint64_t* statusBits;
+	size_t foundCount;
+} ConfBatchContext;
+
+static const char* getConfLookupKey(const void* requests, size_t index, size_t* keyLength)
+{
+	const ConfLookup* lookup = &((const ConfLookup*)requests)[index];
+	assert(lookup->key != NULL);
+	*keyLength = lookup->keyLength;
+	return lookup->key;
+}
+static void onConfLookupMatch(void* context, size_t index, const ConfItem* item)
+{
+	ConfBatchContext* batchContext = (ConfBatchContext*)context;
+	const ConfLookup* lookup = &batchContext->lookups[index];
+	assert(lookup->value != NULL);
+
+	if (!getConfItemValue(batchContext->confReader, item, lookup))
+		return;
+
+	if (batchContext->statusBits)
+		batchContext->statusBits[index / 64] |= 1ull << (index % 64);
+	batchContext->foundCount++;
+}
+
+size_t getConfReaderBatch(ConfReader confReader, const ConfLookup* lookups, size_t lookupCount, uint64_t* statusBits)
+{
+	assert(confReader != NULL);
+	assert(lookups != NULL || lookupCount == 0);
+
+	if (statusBits)
+		memset(statusBits, 0, ((lookupCount + 63) / 64) * sizeof(uint64_t));
+
+	ConfBatchContext context = { confReader, lookups, statusBits, 0 };
+	matchConfItems(confReader, lookups, lookupCount, getConfLookupKey, onConfLookupMatch, &context);
+	return context.foundCount;
+}
+
+//**********************************************************************************************************************
+typedef struct ConfBindContext
+{
+	ConfReader confReader;
+	const ConfBinding* bindings;
+	uint8_t* target;
+	uint64_t* missingBits;
+	uint64_t* mistypedBits;
+	size_t boundCount;
+} ConfBindContext;
+
+inline static bool setConfBindingValue(ConfReader confReader,
+	const ConfBinding* binding, const ConfItem* item, uint8_t* field)
+{
+	switch (binding->type)
+	{
+	case INTEGER_CONF_DATA_TYPE:
+	{
+		int64_t integer = binding->defaultValue.integer;
+		if (item && !getConfItemInt(item, &integer))
+			return false;
+
+		if (binding->isUnsigned)
+		{
+			if (integer < 0)
+				return false;
+
+			uint64_t unsignedInteger = (uint64_t)integer;
+			switch (binding->size)
+			{
+			case sizeof(uint8_t):
+			{
+				if (unsignedInteger > UINT8_MAX)
+					return false;
+				uint8_t value = (uint8_t)unsignedInteger;
+				memcpy(field, &value, sizeof(uint8_t));
+				return true;
+			}
+			case sizeof(uint16_t):
+			{
+				if (unsignedInteger > UINT16_MAX)
+					return false;
+				uint16_t value = (uint16_t)unsignedInteger;
+				memcpy(field, &value, sizeof(uint16_t));
+				return true;
+			}
+			case sizeof(uint32_t):
+			{
+				if (unsignedInteger > UINT32_MAX)
+					return false;
+				uint32_t value = (uint32_t)unsignedInteger;
+				memcpy(field, &value, sizeof(uint32_t));
+				return true;
+			}
+			case sizeof(uint64_t):
+				memcpy(field, &unsignedInteger, sizeof(uint64_t));
+				return true;
+			default:
+				assert(false); // Unsupported integer field size.
+				return false;
+			}
+		}
+
+		switch (binding->size)
+		{
+		case sizeof(int8_t):
+		{
+			if (integer < INT8_MIN || integer > INT8_MAX)
+				return false;
+			int8_t value = (int8_t)integer;
+			memcpy(field, &value, sizeof(int8_t));
+			return true;
+		}
+		case sizeof(int16_t):
+		{
+			if (integer < INT16_MIN || integer > INT16_MAX)
+				return false;
+			int16_t value = (int16_t)integer;
+			memcpy(field, &value, sizeof(int16_t));
+			return true;
+		}
+		case sizeof(int32_t):
+		{
+			if (integer < INT32_MIN || integer > INT32_MAX)
+				return false;
+			int32_t value = (int32_t)integer;
+			memcpy(field, &value, sizeof(int32_t));
+			return true;
+		}
+		case sizeof(int64_t):
+			memcpy(field, &integer, sizeof(int64_t));
+			return true;
+		default:
+			assert(false); // Unsupported integer field size.
+			return false;
+		}
+	}
+	case FLOATING_CONF_DATA_TYPE:
+	{
+		double floating = binding->defaultValue.floating;
+		if (item && !getConfItemFloat(item, &floating))
+			return false;
+
+		if (binding->size == sizeof(float))
+		{
+			if (isfinite(floating) && (floating > FLT_MAX || floating < -FLT_MAX))
+				return false;
+			float value = (float)floating;
+			memcpy(field, &value, sizeof(float));
+			return true;
+		}
+
+		assert(binding->size == sizeof(double));
+		memcpy(field, &floating, sizeof(double));
+		return true;
+	}
+	case BOOLEAN_CONF_DATA_TYPE:
+	{
+		bool boolean = binding->defaultValue.boolean;
+		if (item && !getConfItemBool(item, &boolean))
+			return false;
+
+		assert(binding->size == sizeof(bool));
+		memcpy(field, &boolean, sizeof(bool));
+		return true;
+	}
+	case STRING_CONF_DATA_TYPE:
+	{
+		const char* string = binding->defaultValue.string;
+		uint64_t length = string ? strlen(string) : 0;
+		if (item && !getConfItemString(confReader, item, &string, &length))
+			return false;
+
+		if (binding->size == sizeof(ConfBoundString))
+		{
+			ConfBoundString value = { string, length };
+			memcpy(field, &value, sizeof(ConfBoundString));
+			return true;
+		}
+
+		// Note: borrowed data strings are not null terminated, they can be bound only with a length.
+		if (item && isConfDataBorrowed(confReader))
+			return false;
+
+		assert(binding->size == sizeof(const char*));
+		memcpy(field, &string, sizeof(const char*));
+		return true;
+	}
+	default:
+		assert(false); // Unknown Conf data type.
+		return false;
+	}
+}
+
+static const char* getConfBindingKey(const void* requests, size_t index, size_t* keyLength)
+{
+	const ConfBinding* binding = &((const ConfBinding*)requests)[index];
+	assert(binding->key != NULL);
+	*keyLength = strlen(binding->key);
+	return binding->key;
+}
+static void onConfBindingMatch(void* context, size_t index, const ConfItem* item)
+{
+	ConfBindContext* bindContext = (ConfBindContext*)context;
+	const ConfBinding* binding = &bindContext->bindings[index];
+	uint8_t* field = bindContext->target + binding->offset;
+
+	if (!item)
+	{
+		setConfBindingValue(bindContext->confReader, binding, NULL, field);
+		if (bindContext->missingBits)
+			bindContext->missingBits[index / 64] |= 1ull << (index % 64);
+		return;
+	}
+
+	if (!setConfBindingValue(bindContext->confReader, binding, item, field))
+	{
+		setConfBindingValue(bindContext->confReader, binding, NULL, field);
+		if (bindContext->mistypedBits)
+			bindContext->mistypedBits[index / 64] |= 1ull << (index % 64);
+		return;
+	}
+
+	bindContext->boundCount++;
+}
+
+size_t bindConfReaderStruct(ConfReader confReader, const ConfBinding* bindings,
+	size_t bindingCount, void* target, uint64_t* missingBits, uint64_t* mistypedBits)
+{
+	assert(confReader != NULL);
+	assert(bindings != NULL || bindingCount == 0);
+	assert(target != NULL);
+
+	size_t bitsSize = ((bindingCount + 63) / 64) * sizeof(uint64_t);
+	if (missingBits)
+		memset(missingBits, 0, bitsSize);
+	if (mistypedBits)
+		memset(mistypedBits, 0, bitsSize);
+
+	ConfBindContext context = { confReader, bindings, (uint8_t*)target, missingBits, mistypedBits, 0 };
+	matchConfItems(confReader, bindings, bindingCount, getConfBindingKey, onConfBindingMatch, &context);
+	return context.boundCount;
+}
+
+//**********************************************************************************************************************
+bool resolveConfReaderKey(ConfReader confReader, const char* key, size_t keyLength, size_t* handle)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(handle != NULL);
+
+	const ConfItem* foundItem = findConfItem(confReader, key, keyLength);
+	if (!foundItem)
+		return false;
+
+	*handle = (size_t)(foundItem - confReader->items);
+	return true;
+}
+
+bool resolveConfReaderHashedKey(ConfReader confReader, const char* key,
+	size_t keyLength, uint64_t hash, uint64_t hashSeed, size_t* handle)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(handle != NULL);
+
+	const ConfItem* foundItem;
+	if (confReader->hashSlots && confReader->hashSeed == hashSeed)
+		foundItem = findConfHashItem(confReader, key, keyLength, hash);
+	else
+		foundItem = findConfItem(confReader, key, keyLength);
+
+	if (!foundItem)
+		return false;
+
+	*handle = (size_t)(foundItem - confReader->items);
+	return true;
+}
+
+//**********************************************************************************************************************
+bool getConfReaderType(ConfReader confReader, const char* key, ConfDataType* type)
+{
+	assert(key != NULL);
+	return getConfReaderTypeN(confReader, key, strlen(key), type);
+}
+bool getConfReaderInt(ConfReader confReader, const char* key, int64_t* value)
+{
+	assert(key != NULL);
+	return getConfReaderIntN(confReader, key, strlen(key), value);
+}
+bool getConfReaderFloat(ConfReader confReader, const char* key, double* value)
+{
+	assert(key != NULL);
+	return getConfReaderFloatN(confReader, key, strlen(key), value);
+}
+bool getConfReaderBool(ConfReader confReader, const char* key, bool* value)
+{
+	assert(key != NULL);
+	return getConfReaderBoolN(confReader, key, strlen(key), value);
+}
+bool getConfReaderString(ConfReader confReader, const char* key, const char** value, uint64_t* length)
+{
+	assert(key != NULL);
+	return getConfReaderStringN(confReader, key, strlen(key), value, length);
+}
+
+//**********************************************************************************************************************
+bool getConfReaderTypeN(ConfReader confReader, const char* key, size_t keyLength, ConfDataType* type)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(type != NULL);
+
+	const ConfItem* foundItem = findConfItem(confReader, key, keyLength);
+	if (!foundItem)
+		return false;
+
+	*type = foundItem->type;
+	return true;
+}
+bool getConfReaderIntN(ConfReader confReader, const char* key, size_t keyLength, int64_t* value)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(value != NULL);
+	return getConfItemInt(findConfItem(confReader, key, keyLength), value);
+}
+bool getConfReaderFloatN(ConfReader confReader, const char* key, size_t keyLength, double* value)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(value != NULL);
+	return getConfItemFloat(findConfItem(confReader, key, keyLength), value);
+}
+bool getConfReaderBoolN(ConfReader confReader, const char* key, size_t keyLength, bool* value)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(value != NULL);
+	return getConfItemBool(findConfItem(confReader, key, keyLength), value);
+}
+bool getConfReaderStringN(ConfReader confReader, const char* key,
+	size_t keyLength, const char** value, uint64_t* length)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+	assert(value != NULL);
+	return getConfItemString(confReader, findConfItem(confReader, key, keyLength), value, length);
+}
+
+//**********************************************************************************************************************
+inline static int compareConfPrefix(const char* key, size_t keySize, const char* prefix, size_t prefixLength)
+{
+	// Note: returns 0 if key starts with the prefix.
+	int result = memcmp(key, prefix, (keySize < prefixLength ? keySize : prefixLength) * sizeof(char));
+	if (result != 0)
+		return result;
+	return keySize < prefixLength ? -1 : 0;
+}
+inline static size_t findConfPrefixBound(ConfReader confReader, const char* prefix, size_t prefixLength, bool isUpper)
+{
+	const ConfItem* items = confReader->items;
+	const char* data = confReader->data + confReader->keySkip;
+	size_t low = 0, high = confReader->itemCount, keySkip = confReader->keySkip;
+
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		const ConfItem* item = &items[middle];
+		int result = compareConfPrefix(data + item->keyOffset, item->keySize - keySkip, prefix, prefixLength);
+		if (isUpper ? result <= 0 : result < 0)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+bool findConfReaderPrefix(ConfReader confReader, const char* prefix, size_t prefixLength, size_t* first, size_t* count)
+{
+	assert(confReader != NULL);
+	assert(prefix != NULL || prefixLength == 0);
+	assert(first != NULL);
+	assert(count != NULL);
+
+	size_t lowerBound = findConfPrefixBound(confReader, prefix, prefixLength, false);
+	size_t upperBound = findConfPrefixBound(confReader, prefix, prefixLength, true);
+
+	*first = lowerBound;
+	*count = upperBound - lowerBound;
+	return upperBound > lowerBound;
+}
+
+//**********************************************************************************************************************
+bool getConfReaderSection(ConfReader confReader, const char* name, ConfReader* section)
+{
+	assert(name != NULL);
+	return getConfReaderSectionN(confReader, name, strlen(name), section);
+}
+bool getConfReaderSectionN(ConfReader confReader, const char* name, size_t nameLength, ConfReader* section)
+{
+	assert(confReader != NULL);
+	assert(name != NULL);
+	assert(section != NULL);
+
+	ConfSection* sections = confReader->sections;
+	size_t low = 0, high = confReader->sectionCount;
+	while (low < high)
+	{
+		size_t middle = low + (high - low) / 2;
+		int result = compareConfKeys(name, nameLength, sections[middle].name, sections[middle].nameSize);
+		if (result == 0)
+		{
+			*section = &sections[middle].view;
+			return true;
+		}
+		if (result < 0)
+			high = middle;
+		else
+			low = middle + 1;
+	}
+	return false;
+}
+
+//**********************************************************************************************************************
+size_t getConfReaderItemCount(ConfReader confReader)
+{
+	assert(confReader != NULL);
+	return confReader->itemCount;
+}
+bool getConfReaderItem(ConfReader confReader, size_t index, const char** key, size_t* keyLength, ConfDataType* type)
+{
+	assert(confReader != NULL);
+	assert(key != NULL);
+
+	if (index >= confReader->itemCount)
+		return false;
+
+	const ConfItem* item = &confReader->items[index];
+	*key = confReader->data + item->keyOffset + confReader->keySkip;
+	if (keyLength)
+		*keyLength = item->keySize - confReader->keySkip;
+	if (type)
+		*type = item->type;
+	return true;
+}
+
+ConfDataType getConfReaderTypeAt(ConfReader confReader, size_t handle)
+{
+	assert(confReader != NULL);
+	if (handle >= confReader->itemCount)
+		return CONF_DATA_TYPE_COUNT;
+	return confReader->items[handle].type;
+}
+bool getConfReaderIntAt(ConfReader confReader, size_t handle, int64_t* value)
+{
+	assert(confReader != NULL);
+	assert(value != NULL);
+
+	if (handle >= confReader->itemCount)
+		return false;
+	return getConfItemInt(&confReader->items[handle], value);
+}
+bool getConfReaderFloatAt(ConfReader confReader, size_t handle, double* value)
+{
+	assert(confReader != NULL);
+	assert(value != NULL);
+
+	if (handle >= confReader->itemCount)
+		return false;
+	return getConfItemFloat(&confReader->items[handle], value);
+}
+bool getConfReaderBoolAt(ConfReader confReader, size_t handle, bool* value)
+{
+	assert(confReader != NULL);
+	assert(value != NULL);
+
+	if (handle >= confReader->itemCount)
+		return false;
+	return getConfItemBool(&confReader->items[handle], value);
+}
+bool getConfReaderStringAt(ConfReader confReader, size_t handle, const char** value, uint64_t* length)
+{
+	assert(confReader != NULL);
+	assert(value != NULL);
+
+	if (handle >= confReader->itemCount)
+		return false;
+	return getConfItemString(confReader, &confReader->items[handle], value, length);
+}
+//**********************************************************************************************************************
+inline static bool isConfItemValueEqual(ConfReader oldReader, const ConfItem* oldItem,
+	ConfReader newReader, const ConfItem* newItem)
+{
+	switch (oldItem->type)
+	{
+	case INTEGER_CONF_DATA_TYPE:
+		return oldItem->value.integer == newItem->value.integer;
+	case FLOATING_CONF_DATA_TYPE:
+		// Note: comparing bits, so NaN values are equal and 0.0 differs from -0.0.
+		return memcmp(&oldItem->value.floating, &newItem->value.floating, sizeof(double)) == 0;
+	case BOOLEAN_CONF_DATA_TYPE:
+		return oldItem->value.boolean == newItem->value.boolean;
+	case STRING_CONF_DATA_TYPE:
+		return oldItem->value.string.length == newItem->value.string.length &&
+			memcmp(oldReader->data + oldItem->value.string.offset, newReader->data +
+			newItem->value.string.offset, oldItem->value.string.length) == 0;
+	default:
+		assert(false); // Unknown Conf data type.
+		return false;
+	}
+}
+
+bool nextConfReaderDiff(ConfReader oldReader, ConfReader newReader, ConfDiff* diff)
+{
+	assert(oldReader != NULL);
+	assert(newReader != NULL);
+	assert(diff != NULL);
+
+	size_t oldIndex = diff->oldIndex, newIndex = diff->newIndex;
+	switch (diff->change)
+	{
+	case ADDED_CONF_CHANGE: newIndex++; break;
+	case REMOVED_CONF_CHANGE: oldIndex++; break;
+	case CHANGED_CONF_CHANGE: case RETYPED_CONF_CHANGE: oldIndex++; newIndex++; break;
+	default: break;
+	}
+
+	const ConfItem* oldItems = oldReader->items;
+	const ConfItem* newItems = newReader->items;
+	const char* oldData = oldReader->data;
+	const char* newData = newReader->data;
+	size_t oldCount = oldReader->itemCount, newCount = newReader->itemCount;
+	size_t oldKeySkip = oldReader->keySkip, newKeySkip = newReader->keySkip;
+
+	ConfChange change = CONF_CHANGE_COUNT;
+	while (oldIndex < oldCount && newIndex < newCount)
+	{
+		const ConfItem* oldItem = &oldItems[oldIndex];
+		const ConfItem* newItem = &newItems[newIndex];
+		int difference = compareConfKeys(oldData + oldItem->keyOffset + oldKeySkip, oldItem->keySize - oldKeySkip,
+			newData + newItem->keyOffset + newKeySkip, newItem->keySize - newKeySkip);
+
+		if (difference < 0)
+		{
+			change = REMOVED_CONF_CHANGE;
+			break;
+		}
+		if (difference > 0)
+		{
+			change = ADDED_CONF_CHANGE;
+			break;
+		}
+		if (oldItem->type != newItem->type)
+		{
+			change = RETYPED_CONF_CHANGE;
+			break;
+		}
+		if (!isConfItemValueEqual(oldReader, oldItem, newReader, newItem))
+		{
+			change = CHANGED_CONF_CHANGE;
+			break;
+		}
+		oldIndex++; newIndex++;
+	}
+
+	if (change == CONF_CHANGE_COUNT)
+	{
+		if (oldIndex < oldCount)
+			change = REMOVED_CONF_CHANGE;
+		else if (newIndex < newCount)
+			change = ADDED_CONF_CHANGE;
+	}
+
+	diff->oldIndex = oldIndex;
+	diff->newIndex = newIndex;
+	diff->change = change;
+	return change != CONF_CHANGE_COUNT;
+}
+size_t diffConfReaders(ConfReader oldReader, ConfReader newReader, OnConfDiff onDiff, void* context)
+{
+	assert(oldReader != NULL);
+	assert(newReader != NULL);
+	assert(onDiff != NULL);
+
+	ConfDiff diff;
+	diff.oldIndex = diff.newIndex = 0;
+	diff.change = CONF_CHANGE_COUNT;
+
+	size_t diffCount = 0;
+	while (nextConfReaderDiff(oldReader, newReader, &diff))
+	{
+		const char* key = NULL; size_t keyLength = 0;
+		bool isFound = diff.change == REMOVED_CONF_CHANGE ?
+			getConfReaderItem(oldReader, diff.oldIndex, &key, &keyLength, NULL) :
+			getConfReaderItem(newReader, diff.newIndex, &key, &keyLength, NULL);
+		assert(isFound); // Note: diff indices are always in the item range.
+		(void)isFound;
+		onDiff(key, keyLength, &diff, context);
+		diffCount++;
+	}
+	return diffCount;
+}
+
+//**********************************************************************************************************************
+inline static uint64_t computeConfImageChecksum(const uint8_t* image, size_t imageSize)
+{
+	// Note: checksum covers the whole image after its own header field.
+	size_t offset = offsetof(ConfImageHeader, checksum) + sizeof(uint64_t);
+	return hashConfKey((const char*)image + offset, imageSize - offset, CONF_IMAGE_MAGIC);
+}
+
+inline static bool checkConfImageHeader(const ConfImageHeader* header, size_t imageSize)
+{
+	if (header->magic != CONF_IMAGE_MAGIC || header->version != CONF_IMAGE_VERSION ||
+		header->itemSize != sizeof(ConfItem) || header->imageSize != imageSize)
+	{
+		return false;
+	}
+
+	// Note: each count is limited by the image size before multiplication, so sizes don't overflow.
+	uint64_t size = sizeof(ConfImageHeader), itemCount = header->itemCount, slotCount = header->slotCount;
+	if (itemCount > imageSize / sizeof(ConfItem) || slotCount > imageSize / sizeof(ConfHashSlot) ||
+		header->sectionCount > imageSize / sizeof(ConfImageSection) || header->dataSize > imageSize)
+	{
+		return false;
+	}
+	size += itemCount * sizeof(ConfItem) + slotCount * sizeof(ConfHashSlot) +
+		header->sectionCount * sizeof(ConfImageSection) + header->dataSize;
+	if (size != imageSize)
+		return false;
+
+	// Note: hash table should have at least one empty slot, otherwise probing never stops.
+	if (slotCount > 0 && ((slotCount & (slotCount - 1)) != 0 || slotCount <= itemCount || itemCount >= UINT32_MAX))
+		return false;
+	return true;
+}
+inline static bool checkConfImageItems(const ConfImageHeader* header,
+	const ConfItem* items, const ConfHashSlot* hashSlots, const ConfImageSection* sections)
+{
+	uint64_t itemCount = header->itemCount, dataSize = header->dataSize;
+	for (uint64_t i = 0; i < itemCount; i++)
+	{
+		const ConfItem* item = &items[i];
+		if (item->keyOffset >= dataSize || item->keySize >= dataSize - item->keyOffset ||
+			item->type >= CONF_DATA_TYPE_COUNT)
+		{
+			return false;
+		}
+		if (item->type == STRING_CONF_DATA_TYPE && (item->value.string.offset >= dataSize ||
+			item->value.string.length >= dataSize - item->value.string.offset))
+		{
+			return false;
+		}
+	}
+	for (uint64_t i = 0; i < header->slotCount; i++)
+	{
+		if (hashSlots[i].index > itemCount)
+			return false;
+	}
+	for (uint64_t i = 0; i < header->sectionCount; i++)
+	{
+		const ConfImageSection* section = &sections[i];
+		for (uint64_t j = section->first; j < section->first + section->count; j++)
+		{
+			if (items[j].keySize <= section->nameSize + 1)
+				return false;
+		}
+	}
 	return true;
-}
\ No newline at end of file
+}
+
+ConfResult createImageConfReader(const char* filePath, bool verifyData, ConfReader* confReader)
+{
+	assert(filePath != NULL);
+	assert(confReader != NULL);
+
+	void* image; size_t imageSize;
+	ConfResult confResult = mapConfImage(filePath, &image, &imageSize);
+	if (confResult != SUCCESS_CONF_RESULT)
+		return confResult;
+
+	const ConfImageHeader* header = (const ConfImageHeader*)image;
+	if (!checkConfImageHeader(header, imageSize))
+	{
+		unmapConfImage(image, imageSize);
+		return BAD_IMAGE_CONF_RESULT;
+	}
+
+	uint8_t* imageData = (uint8_t*)image;
+	size_t itemCount = (size_t)header->itemCount, slotCount = (size_t)header->slotCount;
+	size_t sectionCount = (size_t)header->sectionCount, dataSize = (size_t)header->dataSize;
+	ConfItem* items = (ConfItem*)(imageData + sizeof(ConfImageHeader));
+	ConfHashSlot* hashSlots = (ConfHashSlot*)(items + itemCount);
+	const ConfImageSection* imageSections = (const ConfImageSection*)(hashSlots + slotCount);
+	char* data = (char*)(imageSections + sectionCount);
+
+	// Note: sections are always checked, views are created from them.
+	for (size_t i = 0; i < sectionCount; i++)
+	{
+		const ConfImageSection* section = &imageSections[i];
+		if (section->nameOffset >= dataSize || section->nameSize >= dataSize - section->nameOffset - 1 ||
+			section->first > itemCount || section->count > itemCount - section->first)
+		{
+			unmapConfImage(image, imageSize);
+			return BAD_IMAGE_CONF_RESULT;
+		}
+	}
+
+	// Note: item bounds are always checked, getters would read out of the mapping with a bad offset.
+	if (!checkConfImageItems(header, items, hashSlots, imageSections) ||
+		(verifyData && header->checksum != computeConfImageChecksum(imageData, imageSize)))
+	{
+		unmapConfImage(image, imageSize);
+		return BAD_IMAGE_CONF_RESULT;
+	}
+
+	ConfReader confReaderInstance = malloc(sizeof(ConfReader_T));
+	ConfSection* sections = sectionCount > 0 ? malloc(sectionCount * sizeof(ConfSection)) : NULL;
+	if (!confReaderInstance || (sectionCount > 0 && !sections))
+	{
+		free(sections); free(confReaderInstance);
+		unmapConfImage(image, imageSize);
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	confReaderInstance->items = itemCount > 0 ? items : NULL;
+	confReaderInstance->data = data;
+	confReaderInstance->hashSlots = slotCount > 0 ? hashSlots : NULL;
+	confReaderInstance->sections = sections;
+	confReaderInstance->itemCount = itemCount;
+	confReaderInstance->hashMask = slotCount > 0 ? slotCount - 1 : 0;
+	confReaderInstance->hashSeed = header->hashSeed;
+	confReaderInstance->sectionCount = sectionCount;
+	confReaderInstance->keySkip = 0;
+	confReaderInstance->dataSize = dataSize;
+	confReaderInstance->image = image;
+	confReaderInstance->imageSize = imageSize;
+	confReaderInstance->isBorrowed = true;
+	confReaderInstance->isView = false;
+	confReaderInstance->isHashMapped = slotCount > 0;
+
+	for (size_t i = 0; i < sectionCount; i++)
+	{
+		const ConfImageSection* imageSection = &imageSections[i];
+		ConfSection* section = &sections[i];
+		section->name = data + imageSection->nameOffset;
+		section->nameSize = (size_t)imageSection->nameSize;
+
+		ConfReader_T* view = &section->view;
+		view->items = itemCount > 0 ? items + imageSection->first : NULL;
+		view->data = data;
+		view->hashSlots = NULL;
+		view->sections = NULL;
+		view->itemCount = (size_t)imageSection->count;
+		view->hashMask = 0;
+		view->hashSeed = 0;
+		view->sectionCount = 0;
+		view->keySkip = section->nameSize + 1;
+		view->dataSize = 0;
+		view->image = NULL;
+		view->imageSize = 0;
+		view->isBorrowed = true;
+		view->isView = true;
+		view->isHashMapped = false;
+	}
+
+	*confReader = confReaderInstance;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+inline static uint64_t appendConfImageData(char* pool, size_t* poolSize, const char* data, size_t size)
+{
+	uint64_t offset = *poolSize;
+	memcpy(pool + offset, data, size * sizeof(char));
+	pool[offset + size] = '\0';
+	*poolSize += size + 1;
+	return offset;
+}
+
+ConfResult writeConfReaderImage(ConfReader confReader, const char* filePath)
+{
+	assert(confReader != NULL);
+	assert(!confReader->isView);
+	assert(filePath != NULL);
+
+	const ConfItem* items = confReader->items;
+	const ConfSection* sections = confReader->sections;
+	const char* data = confReader->data;
+	size_t itemCount = confReader->itemCount, sectionCount = confReader->sectionCount;
+	size_t slotCount = confReader->hashSlots ? confReader->hashMask + 1 : 0;
+
+	// Note: string pool is rebuilt, so keys and strings are null terminated even for borrowed readers.
+	size_t dataSize = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		dataSize += (size_t)items[i].keySize + 1;
+		if (items[i].type == STRING_CONF_DATA_TYPE)
+			dataSize += (size_t)items[i].value.string.length + 1;
+	}
+	for (size_t i = 0; i < sectionCount; i++)
+		dataSize += sections[i].nameSize + 2;
+
+	size_t imageSize = sizeof(ConfImageHeader) + itemCount * sizeof(ConfItem) +
+		slotCount * sizeof(ConfHashSlot) + sectionCount * sizeof(ConfImageSection) + dataSize;
+	uint8_t* image = calloc(imageSize, sizeof(uint8_t));
+	if (!image)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	ConfImageHeader* header = (ConfImageHeader*)image;
+	ConfItem* imageItems = (ConfItem*)(image + sizeof(ConfImageHeader));
+	ConfHashSlot* imageSlots = (ConfHashSlot*)(imageItems + itemCount);
+	ConfImageSection* imageSections = (ConfImageSection*)(imageSlots + slotCount);
+	char* pool = (char*)(imageSections + sectionCount);
+	size_t poolSize = 0;
+
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		const ConfItem* item = &items[i];
+		ConfItem* imageItem = &imageItems[i];
+		imageItem->keyOffset = appendConfImageData(pool, &poolSize, data + item->keyOffset, item->keySize);
+		imageItem->keySize = item->keySize;
+		imageItem->line = item->line;
+		imageItem->type = item->type;
+
+		switch (item->type)
+		{
+		case INTEGER_CONF_DATA_TYPE:
+			imageItem->value.integer = item->value.integer;
+			break;
+		case FLOATING_CONF_DATA_TYPE:
+			imageItem->value.floating = item->value.floating;
+			break;
+		case BOOLEAN_CONF_DATA_TYPE:
+			imageItem->value.boolean = item->value.boolean;
+			break;
+		case STRING_CONF_DATA_TYPE:
+			imageItem->value.string.length = item->value.string.length;
+			imageItem->value.string.offset = appendConfImageData(pool, &poolSize,
+				data + item->value.string.offset, (size_t)item->value.string.length);
+			break;
+		default:
+			assert(false); // Unknown Conf data type.
+			break;
+		}
+	}
+
+	if (slotCount > 0)
+		memcpy(imageSlots, confReader->hashSlots, slotCount * sizeof(ConfHashSlot));
+
+	for (size_t i = 0; i < sectionCount; i++)
+	{
+		const ConfSection* section = &sections[i];
+		ConfImageSection* imageSection = &imageSections[i];
+		imageSection->nameOffset = appendConfImageData(pool, &poolSize, section->name, section->nameSize + 1);
+		imageSection->nameSize = section->nameSize;
+		imageSection->first = section->view.items ? (uint64_t)(section->view.items - items) : 0;
+		imageSection->count = section->view.itemCount;
+	}
+	assert(poolSize == dataSize);
+
+	header->magic = CONF_IMAGE_MAGIC;
+	header->version = CONF_IMAGE_VERSION;
+	header->itemSize = (uint16_t)sizeof(ConfItem);
+	header->imageSize = imageSize;
+	header->itemCount = itemCount;
+	header->slotCount = slotCount;
+	header->hashSeed = slotCount > 0 ? confReader->hashSeed : 0;
+	header->sectionCount = sectionCount;
+	header->dataSize = dataSize;
+	header->checksum = computeConfImageChecksum(image, imageSize);
+
+	FILE* file = openFile(filePath, "wb");
+	if (!file)
+	{
+		free(image);
+		return FAILED_TO_OPEN_FILE_CONF_RESULT;
+	}
+
+	size_t writeSize = fwrite(image, sizeof(uint8_t), imageSize, file);
+	bool isFlushed = fflush(file) == 0;
+	closeFile(file);
+	free(image);
+
+	if (writeSize != imageSize || !isFlushed)
+		return FAILED_TO_WRITE_FILE_CONF_RESULT;
+	return SUCCESS_CONF_RESULT;
+}
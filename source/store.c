@@ -0,0 +1,255 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/store.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+// Note: all atomic operations are sequentially consistent, reclamation relies on their total order.
+#if defined(__GNUC__) || defined(__clang__)
+#define loadConfAtomic(address) __atomic_load_n(address, __ATOMIC_SEQ_CST)
+#define storeConfAtomic(address, value) __atomic_store_n(address, value, __ATOMIC_SEQ_CST)
+#define incrementConfAtomic(address) __atomic_add_fetch(address, 1, __ATOMIC_SEQ_CST)
+#define compareExchangeConfAtomic(address, expected, desired) __atomic_compare_exchange_n( \
+	address, expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+#define loadConfAtomicPointer(address) __atomic_load_n(address, __ATOMIC_SEQ_CST)
+#define exchangeConfAtomicPointer(address, value) __atomic_exchange_n(address, value, __ATOMIC_SEQ_CST)
+#if defined(__x86_64__) || defined(__i386__)
+#define pauseConfThread() __builtin_ia32_pause()
+#else
+#define pauseConfThread() ((void)0)
+#endif
+#elif _MSC_VER
+#include <intrin.h>
+#define loadConfAtomic(address) ((uint64_t)_InterlockedOr64((volatile __int64*)(address), 0))
+#define storeConfAtomic(address, value) ((void)_InterlockedExchange64((volatile __int64*)(address), (__int64)(value)))
+#define incrementConfAtomic(address) ((uint64_t)_InterlockedIncrement64((volatile __int64*)(address)))
+#define compareExchangeConfAtomic(address, expected, desired) (_InterlockedCompareExchange64( \
+	(volatile __int64*)(address), (__int64)(desired), (__int64)*(expected)) == (__int64)*(expected))
+#define loadConfAtomicPointer(address) _InterlockedCompareExchangePointer((void* volatile*)(address), NULL, NULL)
+#define exchangeConfAtomicPointer(address, value) _InterlockedExchangePointer((void* volatile*)(address), value)
+#define pauseConfThread() _mm_pause()
+#else
+#error Unsupported compiler atomics
+#endif
+
+// Note: each reader slot takes a separate cache line, to prevent false sharing between threads.
+#define CONF_CACHE_LINE_SIZE 64
+
+typedef struct ConfStoreSlot
+{
+	uint64_t epoch;
+	uint64_t isUsed;
+	uint8_t padding[CONF_CACHE_LINE_SIZE - sizeof(uint64_t) * 2];
+} ConfStoreSlot;
+
+typedef struct ConfRetiredReader
+{
+	ConfReader reader;
+	uint64_t epoch;
+} ConfRetiredReader;
+
+struct ConfStore_T
+{
+	ConfReader reader;
+	uint8_t padding[CONF_CACHE_LINE_SIZE - sizeof(ConfReader)];
+	uint64_t epoch;
+	uint64_t writerLock;
+	ConfStoreSlot* slots;
+	void* slotData;
+	ConfRetiredReader* retiredReaders;
+	size_t slotCount;
+	size_t retiredCount;
+	size_t retiredCapacity;
+};
+
+//**********************************************************************************************************************
+ConfResult createConfStore(ConfReader confReader, size_t maxReaderCount, ConfStore* confStore)
+{
+	assert(confReader != NULL);
+	assert(maxReaderCount > 0);
+	assert(confStore != NULL);
+
+	if (maxReaderCount > (SIZE_MAX - CONF_CACHE_LINE_SIZE) / sizeof(ConfStoreSlot))
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	ConfStore confStoreInstance = calloc(1, sizeof(ConfStore_T));
+	if (!confStoreInstance)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	void* slotData = calloc(1, maxReaderCount * sizeof(ConfStoreSlot) + CONF_CACHE_LINE_SIZE);
+	if (!slotData)
+	{
+		free(confStoreInstance);
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	uintptr_t slotAddress = ((uintptr_t)slotData + (CONF_CACHE_LINE_SIZE - 1)) & ~(uintptr_t)(CONF_CACHE_LINE_SIZE - 1);
+	confStoreInstance->reader = confReader;
+	confStoreInstance->epoch = 1; // Note: zero slot epoch means no acquired snapshot.
+	confStoreInstance->slots = (ConfStoreSlot*)slotAddress;
+	confStoreInstance->slotData = slotData;
+	confStoreInstance->slotCount = maxReaderCount;
+
+	*confStore = confStoreInstance;
+	return SUCCESS_CONF_RESULT;
+}
+void destroyConfStore(ConfStore confStore)
+{
+	if (!confStore)
+		return;
+
+	for (size_t i = 0; i < confStore->retiredCount; i++)
+		destroyConfReader(confStore->retiredReaders[i].reader);
+	free(confStore->retiredReaders);
+	destroyConfReader(confStore->reader);
+	free(confStore->slotData);
+	free(confStore);
+}
+
+//**********************************************************************************************************************
+bool registerConfStoreReader(ConfStore confStore, size_t* readerIndex)
+{
+	assert(confStore != NULL);
+	assert(readerIndex != NULL);
+
+	ConfStoreSlot* slots = confStore->slots;
+	size_t slotCount = confStore->slotCount;
+
+	for (size_t i = 0; i < slotCount; i++)
+	{
+		uint64_t isUsed = 0;
+		if (compareExchangeConfAtomic(&slots[i].isUsed, &isUsed, 1))
+		{
+			*readerIndex = i;
+			return true;
+		}
+	}
+	return false;
+}
+void unregisterConfStoreReader(ConfStore confStore, size_t readerIndex)
+{
+	assert(confStore != NULL);
+	assert(readerIndex < confStore->slotCount);
+	assert(confStore->slots[readerIndex].epoch == 0); // Snapshot is not released.
+	storeConfAtomic(&confStore->slots[readerIndex].isUsed, 0);
+}
+
+ConfReader acquireConfStoreSnapshot(ConfStore confStore, size_t readerIndex)
+{
+	assert(confStore != NULL);
+	assert(readerIndex < confStore->slotCount);
+	assert(confStore->slots[readerIndex].epoch == 0); // Snapshot is already acquired.
+
+	// Note: announced epoch store is ordered before the reader load, so writer can't miss this thread.
+	storeConfAtomic(&confStore->slots[readerIndex].epoch, loadConfAtomic(&confStore->epoch));
+	return (ConfReader)loadConfAtomicPointer(&confStore->reader);
+}
+void releaseConfStoreSnapshot(ConfStore confStore, size_t readerIndex)
+{
+	assert(confStore != NULL);
+	assert(readerIndex < confStore->slotCount);
+	storeConfAtomic(&confStore->slots[readerIndex].epoch, 0);
+}
+
+//**********************************************************************************************************************
+inline static void lockConfStoreWriter(ConfStore confStore)
+{
+	while (true)
+	{
+		uint64_t isLocked = 0;
+		if (compareExchangeConfAtomic(&confStore->writerLock, &isLocked, 1))
+			return;
+		pauseConfThread();
+	}
+}
+inline static void unlockConfStoreWriter(ConfStore confStore)
+{
+	storeConfAtomic(&confStore->writerLock, 0);
+}
+
+/*
+ * Destroys retired readers older than all announced epochs. Writer lock should be held.
+ */
+inline static size_t reclaimConfReaders(ConfStore confStore)
+{
+	const ConfStoreSlot* slots = confStore->slots;
+	size_t slotCount = confStore->slotCount;
+	uint64_t minEpoch = UINT64_MAX;
+
+	for (size_t i = 0; i < slotCount; i++)
+	{
+		uint64_t epoch = loadConfAtomic(&slots[i].epoch);
+		if (epoch != 0 && epoch < minEpoch)
+			minEpoch = epoch;
+	}
+
+	ConfRetiredReader* retiredReaders = confStore->retiredReaders;
+	size_t retiredCount = confStore->retiredCount, remainingCount = 0;
+
+	for (size_t i = 0; i < retiredCount; i++)
+	{
+		// Note: thread that announced a later epoch has loaded the newer reader.
+		if (retiredReaders[i].epoch < minEpoch)
+			destroyConfReader(retiredReaders[i].reader);
+		else
+			retiredReaders[remainingCount++] = retiredReaders[i];
+	}
+
+	confStore->retiredCount = remainingCount;
+	return remainingCount;
+}
+
+ConfResult publishConfStore(ConfStore confStore, ConfReader confReader)
+{
+	assert(confStore != NULL);
+	assert(confReader != NULL);
+
+	lockConfStoreWriter(confStore);
+
+	if (confStore->retiredCount == confStore->retiredCapacity)
+	{
+		size_t retiredCapacity = confStore->retiredCapacity > 0 ? confStore->retiredCapacity * 2 : 4;
+		ConfRetiredReader* retiredReaders = realloc(confStore->retiredReaders,
+			retiredCapacity * sizeof(ConfRetiredReader));
+		if (!retiredReaders)
+		{
+			unlockConfStoreWriter(confStore);
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+		}
+
+		confStore->retiredReaders = retiredReaders;
+		confStore->retiredCapacity = retiredCapacity;
+	}
+
+	ConfReader oldReader = (ConfReader)exchangeConfAtomicPointer(&confStore->reader, confReader);
+	ConfRetiredReader* retiredReader = &confStore->retiredReaders[confStore->retiredCount++];
+	retiredReader->reader = oldReader;
+	retiredReader->epoch = loadConfAtomic(&confStore->epoch);
+	incrementConfAtomic(&confStore->epoch);
+
+	reclaimConfReaders(confStore);
+	unlockConfStoreWriter(confStore);
+	return SUCCESS_CONF_RESULT;
+}
+size_t reclaimConfStore(ConfStore confStore)
+{
+	assert(confStore != NULL);
+	lockConfStoreWriter(confStore);
+	size_t retiredCount = reclaimConfReaders(confStore);
+	unlockConfStoreWriter(confStore);
+	return retiredCount;
+}
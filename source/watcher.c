@@ -0,0 +1,377 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/watcher.h"
+
+#include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#if __linux__
+#include <errno.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#endif
+
+typedef struct ConfWatcherCallback
+{
+	char* prefix;
+	size_t prefixLength;
+	OnConfChange onChange;
+	void* context;
+} ConfWatcherCallback;
+
+struct ConfWatcher_T
+{
+	char* filePath;
+	ConfReader reader;
+	ConfWatcherCallback* callbacks;
+	size_t callbackCount;
+	size_t callbackCapacity;
+	ConfStore store;
+	size_t storeIndex;
+	int64_t fileTime;
+	int64_t fileSize;
+	bool isPending;
+#if __linux__
+	const char* fileName;
+	int notifyFile;
+#endif
+};
+
+//**********************************************************************************************************************
+inline static bool getConfFileStatus(const char* filePath, int64_t* fileTime, int64_t* fileSize)
+{
+	struct stat fileStatus;
+	if (stat(filePath, &fileStatus) != 0)
+		return false;
+
+	*fileTime = (int64_t)fileStatus.st_mtime;
+	*fileSize = (int64_t)fileStatus.st_size;
+	return true;
+}
+
+#if __linux__
+inline static void initConfWatcherNotify(ConfWatcher confWatcher)
+{
+	// Note: watching the parent directory, editors often replace files with a rename.
+	const char* filePath = confWatcher->filePath;
+	const char* separator = strrchr(filePath, '/');
+	confWatcher->fileName = separator ? separator + 1 : filePath;
+	confWatcher->notifyFile = -1;
+
+	size_t directoryLength = separator ? (size_t)(separator - filePath) : 0;
+	char* directory = malloc(directoryLength + 2);
+	if (!directory)
+		return;
+
+	if (separator)
+	{
+		memcpy(directory, filePath, directoryLength);
+		if (directoryLength == 0)
+			directory[directoryLength++] = '/';
+		directory[directoryLength] = '\0';
+	}
+	else
+	{
+		directory[0] = '.'; directory[1] = '\0';
+	}
+
+	int notifyFile = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (notifyFile >= 0)
+	{
+		if (inotify_add_watch(notifyFile, directory, IN_CLOSE_WRITE | IN_MOVED_TO) >= 0)
+			confWatcher->notifyFile = notifyFile;
+		else
+			close(notifyFile);
+	}
+	free(directory);
+}
+inline static bool readConfWatcherNotify(ConfWatcher confWatcher)
+{
+	char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	const char* fileName = confWatcher->fileName;
+	bool isChanged = false;
+
+	while (true)
+	{
+		ssize_t length = read(confWatcher->notifyFile, buffer, sizeof(buffer));
+		if (length <= 0)
+			break;
+
+		for (char* event = buffer; event < buffer + length; )
+		{
+			const struct inotify_event* notifyEvent = (const struct inotify_event*)event;
+			if (notifyEvent->len > 0 && strcmp(notifyEvent->name, fileName) == 0)
+				isChanged = true;
+			event += sizeof(struct inotify_event) + notifyEvent->len;
+		}
+	}
+	return isChanged;
+}
+#endif
+
+//**********************************************************************************************************************
+ConfResult createConfWatcher(const char* filePath, ConfWatcher* confWatcher, size_t* errorLine)
+{
+	assert(filePath != NULL);
+	assert(confWatcher != NULL);
+
+	ConfWatcher confWatcherInstance = calloc(1, sizeof(ConfWatcher_T));
+	if (!confWatcherInstance)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	size_t pathLength = strlen(filePath);
+	char* filePathCopy = malloc(pathLength + 1);
+	if (!filePathCopy)
+	{
+		free(confWatcherInstance);
+		if (errorLine)
+			*errorLine = 0;
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	}
+
+	memcpy(filePathCopy, filePath, pathLength + 1);
+	confWatcherInstance->filePath = filePathCopy;
+
+	// Note: reading file status before the content, so a concurrent write is detected on the next update.
+	getConfFileStatus(filePath, &confWatcherInstance->fileTime, &confWatcherInstance->fileSize);
+
+	#if __linux__
+	initConfWatcherNotify(confWatcherInstance);
+	#endif
+
+	ConfResult result = createFileConfReader(filePath, &confWatcherInstance->reader, errorLine);
+	if (result != SUCCESS_CONF_RESULT)
+	{
+		destroyConfWatcher(confWatcherInstance);
+		return result;
+	}
+
+	*confWatcher = confWatcherInstance;
+	return SUCCESS_CONF_RESULT;
+}
+void destroyConfWatcher(ConfWatcher confWatcher)
+{
+	if (!confWatcher)
+		return;
+
+	#if __linux__
+	if (confWatcher->notifyFile >= 0)
+		close(confWatcher->notifyFile);
+	#endif
+
+	for (size_t i = 0; i < confWatcher->callbackCount; i++)
+		free(confWatcher->callbacks[i].prefix);
+	free(confWatcher->callbacks);
+
+	// Note: attached store owns the reader and outlives the watcher.
+	if (confWatcher->store)
+		unregisterConfStoreReader(confWatcher->store, confWatcher->storeIndex);
+	else
+		destroyConfReader(confWatcher->reader);
+	free(confWatcher->filePath);
+	free(confWatcher);
+}
+
+ConfResult createConfWatcherStore(ConfWatcher confWatcher, size_t maxReaderCount, ConfStore* confStore)
+{
+	assert(confWatcher != NULL);
+	assert(confWatcher->store == NULL);
+	assert(maxReaderCount > 0);
+	assert(confStore != NULL);
+
+	if (maxReaderCount == SIZE_MAX)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	ConfStore confStoreInstance;
+	ConfResult result = createConfStore(confWatcher->reader, maxReaderCount + 1, &confStoreInstance);
+	if (result != SUCCESS_CONF_RESULT)
+		return result;
+
+	bool isRegistered = registerConfStoreReader(confStoreInstance, &confWatcher->storeIndex);
+	assert(isRegistered); // Note: new store has free reader slots.
+	(void)isRegistered;
+
+	confWatcher->store = confStoreInstance;
+	*confStore = confStoreInstance;
+	return SUCCESS_CONF_RESULT;
+}
+
+ConfReader getConfWatcherReader(ConfWatcher confWatcher)
+{
+	assert(confWatcher != NULL);
+	return confWatcher->reader;
+}
+
+ConfResult addConfWatcherCallback(ConfWatcher confWatcher, const char* prefix, OnConfChange onChange, void* context)
+{
+	assert(confWatcher != NULL);
+	assert(prefix != NULL);
+	assert(onChange != NULL);
+
+	if (confWatcher->callbackCount == confWatcher->callbackCapacity)
+	{
+		size_t callbackCapacity = confWatcher->callbackCapacity > 0 ? confWatcher->callbackCapacity * 2 : 4;
+		ConfWatcherCallback* callbacks = realloc(confWatcher->callbacks,
+			callbackCapacity * sizeof(ConfWatcherCallback));
+		if (!callbacks)
+			return FAILED_TO_ALLOCATE_CONF_RESULT;
+
+		confWatcher->callbacks = callbacks;
+		confWatcher->callbackCapacity = callbackCapacity;
+	}
+
+	size_t prefixLength = strlen(prefix);
+	char* prefixCopy = malloc(prefixLength + 1);
+	if (!prefixCopy)
+		return FAILED_TO_ALLOCATE_CONF_RESULT;
+	memcpy(prefixCopy, prefix, prefixLength + 1);
+
+	ConfWatcherCallback* callback = &confWatcher->callbacks[confWatcher->callbackCount++];
+	callback->prefix = prefixCopy;
+	callback->prefixLength = prefixLength;
+	callback->onChange = onChange;
+	callback->context = context;
+	return SUCCESS_CONF_RESULT;
+}
+
+//**********************************************************************************************************************
+typedef struct ConfWatcherDiff
+{
+	ConfWatcher confWatcher;
+	ConfReader oldReader;
+	ConfReader newReader;
+} ConfWatcherDiff;
+
+static void onConfWatcherDiff(const char* key, size_t keyLength, const ConfDiff* diff, void* context)
+{
+	const ConfWatcherDiff* watcherDiff = (const ConfWatcherDiff*)context;
+	const ConfWatcherCallback* callbacks = watcherDiff->confWatcher->callbacks;
+	size_t callbackCount = watcherDiff->confWatcher->callbackCount;
+
+	for (size_t i = 0; i < callbackCount; i++)
+	{
+		const ConfWatcherCallback* callback = &callbacks[i];
+		if (callback->prefixLength <= keyLength && memcmp(key, callback->prefix, callback->prefixLength) == 0)
+		{
+			callback->onChange(key, keyLength, diff->change,
+				watcherDiff->oldReader, watcherDiff->newReader, callback->context);
+		}
+	}
+}
+
+//**********************************************************************************************************************
+ConfResult reloadConfWatcher(ConfWatcher confWatcher, size_t* errorLine)
+{
+	assert(confWatcher != NULL);
+
+	// Note: change stays pending until the reload succeeds, a half-written file is read again on the next update.
+	confWatcher->isPending = true;
+
+	// Note: reading file status before the content, so a concurrent write is detected on the next update.
+	int64_t fileTime = confWatcher->fileTime, fileSize = confWatcher->fileSize;
+	getConfFileStatus(confWatcher->filePath, &fileTime, &fileSize);
+
+	ConfReader newReader;
+	ConfResult result = createFileConfReader(confWatcher->filePath, &newReader, errorLine);
+	if (result != SUCCESS_CONF_RESULT)
+		return result;
+
+	// Note: swapping reader before the callbacks, old one stays valid until they return.
+	ConfReader oldReader = confWatcher->reader;
+	ConfStore confStore = confWatcher->store;
+
+	if (confStore)
+	{
+		// Note: pinning the old reader, store destroys it only after all snapshots are released.
+		ConfReader snapshot = acquireConfStoreSnapshot(confStore, confWatcher->storeIndex);
+		assert(snapshot == oldReader); // Store should be published only by the watcher.
+		(void)snapshot;
+
+		result = publishConfStore(confStore, newReader);
+		if (result != SUCCESS_CONF_RESULT)
+		{
+			releaseConfStoreSnapshot(confStore, confWatcher->storeIndex);
+			destroyConfReader(newReader);
+			if (errorLine)
+				*errorLine = 0;
+			return result;
+		}
+	}
+	confWatcher->reader = newReader;
+	confWatcher->fileTime = fileTime;
+	confWatcher->fileSize = fileSize;
+	confWatcher->isPending = false;
+
+	if (confWatcher->callbackCount > 0)
+	{
+		ConfWatcherDiff watcherDiff;
+		watcherDiff.confWatcher = confWatcher;
+		watcherDiff.oldReader = oldReader;
+		watcherDiff.newReader = newReader;
+		diffConfReaders(oldReader, newReader, onConfWatcherDiff, &watcherDiff);
+	}
+
+	if (confStore)
+	{
+		releaseConfStoreSnapshot(confStore, confWatcher->storeIndex);
+		reclaimConfStore(confStore);
+	}
+	else
+	{
+		destroyConfReader(oldReader);
+	}
+	return SUCCESS_CONF_RESULT;
+}
+
+ConfResult updateConfWatcher(ConfWatcher confWatcher, bool* isReloaded, size_t* errorLine)
+{
+	assert(confWatcher != NULL);
+
+	bool isChanged;
+	#if __linux__
+	if (confWatcher->notifyFile >= 0)
+	{
+		isChanged = readConfWatcherNotify(confWatcher);
+	}
+	else
+	#endif
+	{
+		int64_t fileTime, fileSize;
+		isChanged = getConfFileStatus(confWatcher->filePath, &fileTime, &fileSize) &&
+			(fileTime != confWatcher->fileTime || fileSize != confWatcher->fileSize);
+	}
+	isChanged |= confWatcher->isPending;
+
+	if (isReloaded)
+		*isReloaded = false;
+
+	if (!isChanged)
+	{
+		if (errorLine)
+			*errorLine = 0;
+		return SUCCESS_CONF_RESULT;
+	}
+
+	ConfResult result = reloadConfWatcher(confWatcher, errorLine);
+	if (result == SUCCESS_CONF_RESULT && isReloaded)
+		*isReloaded = true;
+	return result;
+}
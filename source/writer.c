@@ -16,8 +16,10 @@
 #include "mpio/file.h"
 
 #include <math.h>
+#include <float.h>
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 
 struct ConfWriter_T
 {
@@ -68,6 +70,13 @@ bool writeConfNewLine(ConfWriter confWriter)
 	return fputc('\n', confWriter->file) == '\n';
 }
 
+bool writeConfSection(ConfWriter confWriter, const char* name)
+{
+	assert(confWriter);
+	assert(name);
+	return fprintf(confWriter->file, "[%s]\n", name) > 0;
+}
+
 bool writeConfInt(ConfWriter confWriter, const char* key, int64_t value)
 {
 	assert(confWriter);
@@ -75,20 +84,44 @@ bool writeConfInt(ConfWriter confWriter, const char* key, int64_t value)
 	return fprintf(confWriter->file, "%s: %lld\n", key, (long long int)value) > 0;
 }
 
-inline static bool getDoubleDigitCount(double value, uint8_t* count)
+inline static int formatConfFloat(char* buffer, size_t bufferSize, double value, uint8_t precision)
 {
-	uint8_t digitCount = 0;
+	assert(buffer);
+	assert(bufferSize > 0);
 
-	while ((double)((int64_t)value) != value)
+	int length;
+	if (precision > 0)
 	{
-		value = value * 10.0;
-		digitCount++;
-		if (digitCount == UINT8_MAX)
-			return false;
+		length = snprintf(buffer, bufferSize, "%.*f", (int)precision, value);
+		if (length <= 0 || (size_t)length >= bufferSize)
+			return -1;
+
+		// Note: dropping trailing zeros, keeping at least one digit after the point.
+		while (length > 2 && buffer[length - 1] == '0' && buffer[length - 2] != '.')
+			buffer[--length] = '\0';
+		return length;
+	}
+
+	// Note: 17 significant digits always round trip, shorter output is used if it parses back the same.
+	for (int digitCount = 15; digitCount <= 17; digitCount++)
+	{
+		length = snprintf(buffer, bufferSize, "%.*g", digitCount, value);
+		if (length <= 0 || (size_t)length >= bufferSize)
+			return -1;
+		if (strtod(buffer, NULL) == value)
+			break;
 	}
 
-	*count = digitCount > 0 ? digitCount : 1;
-	return true;
+	// Note: keeping the value floating, otherwise it is read back as an integer.
+	if (!strpbrk(buffer, ".eE"))
+	{
+		if ((size_t)length + 2 >= bufferSize)
+			return -1;
+		buffer[length++] = '.';
+		buffer[length++] = '0';
+		buffer[length] = '\0';
+	}
+	return length;
 }
 bool writeConfFloat(ConfWriter confWriter, const char* key, double value, uint8_t precision)
 {
@@ -109,14 +142,11 @@ bool writeConfFloat(ConfWriter confWriter, const char* key, double value, uint8_
 	}
 	else
 	{
-		uint8_t digitCount;
-		if (!getDoubleDigitCount(value, &digitCount))
+		// Note: sign, all integer digits of the DBL_MAX, point and up to 255 fraction digits.
+		char buffer[DBL_MAX_10_EXP + UINT8_MAX + 8];
+		if (formatConfFloat(buffer, sizeof(buffer), value, precision) < 0)
 			return false;
-
-		if (precision > 0 && precision < digitCount)
-			digitCount = precision;
-
-		return fprintf(confWriter->file, "%s: %.*f\n", key, digitCount, value) > 0;
+		return fprintf(confWriter->file, "%s: %s\n", key, buffer) > 0;
 	}
 }
 
@@ -0,0 +1,161 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/layers.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+inline static bool addTestLayer(ConfLayers confLayers, const char* data)
+{
+	ConfReader confReader; size_t errorLine;
+	if (createDataConfReader(data, &confReader, &errorLine) != SUCCESS_CONF_RESULT)
+		return false;
+	if (addConfLayersReader(confLayers, confReader) != SUCCESS_CONF_RESULT)
+	{
+		destroyConfReader(confReader);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+inline static bool testLayersOverride()
+{
+	ConfLayers confLayers;
+	if (createConfLayers(&confLayers) != SUCCESS_CONF_RESULT)
+	{
+		printf("testLayersOverride: failed to create layers.\n");
+		return false;
+	}
+
+	const char* environment[] = { "PATH=/bin", "APP_net__port=8080", "APP_e=~", "OTHER=1", NULL };
+	const char* arguments[] = { "program", "--a=5", "positional", "--flag", "--", "--b=z", NULL };
+
+	size_t errorLine;
+	bool result = addTestLayer(confLayers, "a: 1\nb: x\nc: true\n[net]\nport: 80\n") &&
+		addTestLayer(confLayers, "b: y\nc: ~\nd: 2.5\nunknown: ~\n") &&
+		addConfLayersEnvironment(confLayers, environment, "APP_", &errorLine) == SUCCESS_CONF_RESULT &&
+		addConfLayersArguments(confLayers, 6, arguments, &errorLine) == SUCCESS_CONF_RESULT;
+
+	int64_t integer; double floating; bool boolean; const char* string; uint64_t length;
+	result &= getConfLayersCount(confLayers) == 4 && getConfLayersItemCount(confLayers) == 4 &&
+		getConfLayersInt(confLayers, "a", &integer) && integer == 5 &&
+		getConfLayersString(confLayers, "b", &string, &length) && length == 1 && string[0] == 'y' &&
+		!getConfLayersBool(confLayers, "c", &boolean) && !getConfLayersString(confLayers, "e", &string, &length) &&
+		getConfLayersFloat(confLayers, "d", &floating) && floating == 2.5 &&
+		getConfLayersInt(confLayers, "net.port", &integer) && integer == 8080 &&
+		!getConfLayersInt(confLayers, "flag", &integer) && !getConfLayersInt(confLayers, "unknown", &integer);
+
+	// Note: unset key can be set again by the next layer.
+	ConfDataType type;
+	result &= addTestLayer(confLayers, "c: 3\n") && getConfLayersItemCount(confLayers) == 5 &&
+		getConfLayersType(confLayers, "c", &type) && type == INTEGER_CONF_DATA_TYPE;
+
+	const char* keys[] = { "a", "b", "c", "d", "net.port" };
+	for (size_t i = 0; i < getConfLayersItemCount(confLayers) && result; i++)
+	{
+		const char* key; size_t keyLength; ConfReader confReader; size_t handle;
+		getConfLayersItem(confLayers, i, &key, &keyLength, &confReader, &handle);
+		result = keyLength == strlen(keys[i]) && memcmp(key, keys[i], keyLength) == 0;
+	}
+	destroyConfLayers(confLayers);
+
+	if (!result)
+	{
+		printf("testLayersOverride: incorrect values. (line: %llu)\n", (long long unsigned int)errorLine);
+		return false;
+	}
+	return true;
+}
+inline static bool testLayersErrors()
+{
+	ConfLayers confLayers;
+	if (createConfLayers(&confLayers) != SUCCESS_CONF_RESULT)
+	{
+		printf("testLayersErrors: failed to create layers.\n");
+		return false;
+	}
+
+	const char* badKeyEnvironment[] = { "HOME=/root", "APP_bad:key=1", NULL };
+	const char* badKeyArguments[] = { "program", "--a=1", "--=2" };
+	const char* badValueArguments[] = { "program", "--a=1\n2" };
+	const char* repeatArguments[] = { "program", "--a=1", "--a=2" };
+
+	size_t errorLine;
+	bool result = addConfLayersEnvironment(confLayers, badKeyEnvironment,
+		"APP_", &errorLine) == BAD_KEY_CONF_RESULT && errorLine == 2;
+	result &= addConfLayersArguments(confLayers, 3, badKeyArguments, &errorLine) == BAD_KEY_CONF_RESULT &&
+		errorLine == 3;
+	result &= addConfLayersArguments(confLayers, 2, badValueArguments, &errorLine) == BAD_VALUE_CONF_RESULT &&
+		errorLine == 2;
+	result &= addConfLayersArguments(confLayers, 3, repeatArguments, &errorLine) == REPEATING_KEYS_CONF_RESULT &&
+		errorLine == 3;
+
+	int64_t integer;
+	result &= getConfLayersCount(confLayers) == 0 && getConfLayersItemCount(confLayers) == 0 &&
+		!getConfLayersInt(confLayers, "a", &integer);
+	destroyConfLayers(confLayers);
+
+	if (!result)
+	{
+		printf("testLayersErrors: incorrect result. (line: %llu)\n", (long long unsigned int)errorLine);
+		return false;
+	}
+	return true;
+}
+
+inline static bool testLayersEmptyValues()
+{
+	ConfLayers confLayers;
+	if (createConfLayers(&confLayers) != SUCCESS_CONF_RESULT)
+	{
+		printf("testLayersEmptyValues: failed to create layers.\n");
+		return false;
+	}
+
+	const char* environment[] = { "APP_a=", "APP_b=2", NULL };
+	const char* arguments[] = { "program", "--b=", "--c=3", NULL };
+
+	size_t errorLine = 0;
+	bool result = addTestLayer(confLayers, "a: 1\nb: 1\n") &&
+		addConfLayersEnvironment(confLayers, environment, "APP_", &errorLine) == SUCCESS_CONF_RESULT &&
+		addConfLayersArguments(confLayers, 3, arguments, &errorLine) == SUCCESS_CONF_RESULT;
+
+	// Note: empty values don't override or unset items of the previous layers.
+	int64_t integer;
+	result &= getConfLayersItemCount(confLayers) == 3 &&
+		getConfLayersInt(confLayers, "a", &integer) && integer == 1 &&
+		getConfLayersInt(confLayers, "b", &integer) && integer == 2 &&
+		getConfLayersInt(confLayers, "c", &integer) && integer == 3;
+	destroyConfLayers(confLayers);
+
+	if (!result)
+	{
+		printf("testLayersEmptyValues: incorrect values. (line: %llu)\n", (long long unsigned int)errorLine);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+int main()
+{
+	bool result = testLayersOverride();
+	result &= testLayersErrors();
+	result &= testLayersEmptyValues();
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
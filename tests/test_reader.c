@@ -16,11 +16,13 @@
 #include "mpio/file.h"
 
 #include <math.h>
+#include <stddef.h>
 #include <string.h>
 #include <assert.h>
 #include <stdlib.h>
 
 #define TEST_FILE_NAME "testing-conf.txt"
+#define TEST_IMAGE_FILE_NAME "testing-conf-image.bin"
 
 inline static bool createTestFile(const char* content)
 {
@@ -182,6 +184,53 @@ inline static bool testBadValueSpacing()
 	return removeTestFile();
 }
 
+inline static bool testRepeatingKeys(const char* data, size_t repeatLine, size_t firstRepeatLine)
+{
+	assert(data);
+
+	ConfReader confReader;
+	size_t errorLine, firstLine;
+
+	ConfResult confResult = createDataConfReaderEx(data, strlen(data), &confReader, &errorLine, &firstLine);
+	if (confResult != REPEATING_KEYS_CONF_RESULT)
+	{
+		printf("testRepeatingKeys: incorrect result. (%s)\n",
+			confResultToString(confResult));
+		if (confResult == SUCCESS_CONF_RESULT)
+			destroyConfReader(confReader);
+		return false;
+	}
+
+	if (errorLine != repeatLine || firstLine != firstRepeatLine)
+	{
+		printf("testRepeatingKeys: incorrect error lines. "
+			"(reference: %llu %llu, result: %llu %llu)\n", (long long unsigned int)repeatLine,
+			(long long unsigned int)firstRepeatLine, (long long unsigned int)errorLine,
+			(long long unsigned int)firstLine);
+		return false;
+	}
+
+	return true;
+}
+inline static bool testManyRepeatingKeys()
+{
+	char* data = malloc(1001 * 16 + 1);
+	if (!data)
+	{
+		printf("testManyRepeatingKeys: failed to allocate data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (int i = 0; i < 1000; i++)
+		dataSize += sprintf(data + dataSize, "key%d: %d\n", i, i);
+	sprintf(data + dataSize, "key500: true\n");
+
+	bool result = testRepeatingKeys(data, 1001, 501);
+	free(data);
+	return result;
+}
+
 //**********************************************************************************************************************
 inline static bool testInteger(int64_t value, const char* stringValue)
 {
@@ -576,6 +625,1252 @@ inline static bool testDataConfig()
 	return result;
 }
 
+inline static bool testEmptyConfig()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(
+		"# Only comments\n\n#here\n", &confReader, &errorLine);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testEmptyConfig: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	ConfDataType type;
+	if (getConfReaderType(confReader, "integer", &type))
+	{
+		printf("testEmptyConfig: found not existing item.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	return true;
+}
+inline static bool testSizedDataConfig()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	const char* data = "first: 12345\nsecond: 2";
+	ConfResult confResult = createDataConfReaderN(data, 11, &confReader, &errorLine);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testSizedDataConfig: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	int64_t integer;
+	if (!getConfReaderInt(confReader, "first", &integer) || integer != 1234)
+	{
+		printf("testSizedDataConfig: incorrect first value.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+	if (getConfReaderInt(confReader, "second", &integer))
+	{
+		printf("testSizedDataConfig: read item out of data bounds.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	return true;
+}
+inline static bool testLongLines()
+{
+	// Note: line lengths are crossing SIMD block boundaries at different positions.
+	char* data = malloc(80 * 160 + 1);
+	if (!data)
+	{
+		printf("testLongLines: failed to allocate data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (int i = 1; i <= 80; i++)
+	{
+		for (int j = 0; j < i; j++)
+			data[dataSize++] = (char)('a' + j % 26);
+		dataSize += sprintf(data + dataSize, ": %0*d%s\n", i, i, i % 2 == 0 ? "x" : "\r");
+	}
+	data[dataSize] = '\0';
+
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReaderN(data, dataSize, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testLongLines: incorrect result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		free(data);
+		return false;
+	}
+
+	bool result = true;
+	char key[96];
+	for (int i = 1; i <= 80 && result; i++)
+	{
+		for (int j = 0; j < i; j++)
+			key[j] = (char)('a' + j % 26);
+		key[i] = '\0';
+
+		if (i % 2 == 0)
+		{
+			const char* string; uint64_t length;
+			result = getConfReaderString(confReader, key, &string, &length) &&
+				length == (uint64_t)i + 1 && string[i] == 'x' && atoi(string) == i;
+		}
+		else
+		{
+			int64_t integer;
+			result = getConfReaderInt(confReader, key, &integer) && integer == i;
+		}
+
+		if (!result)
+			printf("testLongLines: incorrect item. (key size: %d)\n", i);
+	}
+
+	destroyConfReader(confReader);
+	free(data);
+	return result;
+}
+inline static bool testBorrowedDataConfig()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	size_t dataSize = strlen(testConfigString);
+	ConfResult confResult = createBorrowedDataConfReader(
+		testConfigString, dataSize, &confReader, &errorLine);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testBorrowedDataConfig: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	int64_t integer;
+	bool result = getConfReaderInt(confReader, "integer", &integer);
+
+	if (!result || integer != 123456789)
+	{
+		printf("testBorrowedDataConfig: failed to get integer value.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	const char* string;
+	uint64_t length;
+	result = getConfReaderString(confReader, "string ", &string, &length);
+
+	if (!result || length != strlen("Hello world!") ||
+		memcmp(string, "Hello world!", length) != 0)
+	{
+		printf("testBorrowedDataConfig: failed to get string value.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	ConfMemoryUsage memoryUsage;
+	getConfReaderMemoryUsage(confReader, &memoryUsage);
+
+	if (string < testConfigString || string >= testConfigString + dataSize ||
+		!isConfReaderBorrowed(confReader) || memoryUsage.data != 0)
+	{
+		printf("testBorrowedDataConfig: string value is not borrowed.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	return true;
+}
+inline static bool testHashIndex(uint64_t seed)
+{
+	char* data = malloc(1000 * 16 + 1);
+	if (!data)
+	{
+		printf("testHashIndex: failed to allocate data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (int i = 0; i < 1000; i++)
+		dataSize += sprintf(data + dataSize, "key%d: %d\n", i, i);
+
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReaderN(data, dataSize, &confReader, &errorLine);
+	free(data);
+
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = buildConfReaderHashIndex(confReader, seed);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testHashIndex: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	char key[16];
+	for (int i = 0; i < 1000; i++)
+	{
+		sprintf(key, "key%d", i);
+
+		int64_t integer;
+		if (!getConfReaderInt(confReader, key, &integer) || integer != i)
+		{
+			printf("testHashIndex: failed to get value. (key: %s, seed: %llu)\n",
+				key, (long long unsigned int)seed);
+			destroyConfReader(confReader);
+			return false;
+		}
+	}
+
+	ConfDataType type;
+	if (getConfReaderType(confReader, "key1000", &type) ||
+		getConfReaderType(confReader, "key", &type) ||
+		getConfReaderType(confReader, "", &type))
+	{
+		printf("testHashIndex: found missing key. (seed: %llu)\n",
+			(long long unsigned int)seed);
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	return true;
+}
+inline static bool testKeyHandles()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(testConfigString, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testKeyHandles: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	const char* keys = "integerDOUBLEstring ";
+	size_t integerHandle, floatingHandle, stringHandle, missingHandle;
+
+	if (!resolveConfReaderKey(confReader, keys, 7, &integerHandle) ||
+		!resolveConfReaderKey(confReader, keys + 7, 6, &floatingHandle) ||
+		!resolveConfReaderKey(confReader, keys + 13, 7, &stringHandle) ||
+		resolveConfReaderKey(confReader, keys, 6, &missingHandle))
+	{
+		printf("testKeyHandles: failed to resolve keys.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	int64_t integer; double floating; bool boolean;
+	const char* string; uint64_t length;
+
+	if (getConfReaderTypeAt(confReader, integerHandle) != INTEGER_CONF_DATA_TYPE ||
+		!getConfReaderIntAt(confReader, integerHandle, &integer) || integer != 123456789 ||
+		!getConfReaderFloatAt(confReader, floatingHandle, &floating) || floating != 0.123 ||
+		!getConfReaderStringAt(confReader, stringHandle, &string, &length) ||
+		length != strlen("Hello world!") || memcmp(string, "Hello world!", length) != 0 ||
+		getConfReaderBoolAt(confReader, integerHandle, &boolean))
+	{
+		printf("testKeyHandles: failed to get value by handle.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	ConfDataType type;
+	if (!getConfReaderTypeN(confReader, keys + 7, 6, &type) || type != FLOATING_CONF_DATA_TYPE ||
+		!getConfReaderIntN(confReader, keys, 7, &integer) || integer != 123456789 ||
+		!getConfReaderStringN(confReader, keys + 13, 7, &string, NULL) ||
+		getConfReaderIntN(confReader, keys, 8, &integer) || getConfReaderBoolN(confReader, keys, 7, &boolean))
+	{
+		printf("testKeyHandles: failed to get value by sized key.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	return true;
+}
+inline static bool testHashedKeys()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(testConfigString, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testHashedKeys: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	uint64_t seeds[3] = { 0, 1, 0x9E3779B97F4A7C15ull };
+	for (int i = 0; i < 4; i++)
+	{
+		if (i > 0)
+		{
+			confResult = buildConfReaderHashIndex(confReader, seeds[i - 1]);
+			if (confResult != SUCCESS_CONF_RESULT)
+			{
+				printf("testHashedKeys: failed to build hash index.\n");
+				destroyConfReader(confReader);
+				return false;
+			}
+		}
+
+		size_t handle, missingHandle; int64_t integer;
+		uint64_t hash = hashConfKey("integer", 7, seeds[0]);
+
+		if (!resolveConfReaderHashedKey(confReader, "integer", 7, hash, seeds[0], &handle) ||
+			!getConfReaderIntAt(confReader, handle, &integer) || integer != 123456789 ||
+			resolveConfReaderHashedKey(confReader, "integer", 6, hash, seeds[0], &missingHandle))
+		{
+			printf("testHashedKeys: failed to resolve key. (pass: %d)\n", i);
+			destroyConfReader(confReader);
+			return false;
+		}
+	}
+
+	if (hashConfKey("integer", 7, 0) == hashConfKey("integer", 7, 1) ||
+		hashConfKey("integer", 7, 0) == hashConfKey("integer", 6, 0))
+	{
+		printf("testHashedKeys: bad key hash function.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	destroyConfReader(confReader);
+	return true;
+}
+inline static bool testBatchLookup(bool buildHashIndex, bool sortedKeys)
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(testConfigString, &confReader, &errorLine);
+	if (confResult == SUCCESS_CONF_RESULT && buildHashIndex)
+		confResult = buildConfReaderHashIndex(confReader, 1);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testBatchLookup: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	int64_t integer = 0; double floating = 0.0, integerFloating = 0.0;
+	bool boolean = false, missing = false; const char* string = NULL; uint64_t length = 0;
+
+	ConfLookup lookups[6] =
+	{
+		{ "integer", 7, INTEGER_CONF_DATA_TYPE, &integer, NULL },
+		{ "DOUBLE", 6, FLOATING_CONF_DATA_TYPE, &floating, NULL },
+		{ "Boolean", 7, BOOLEAN_CONF_DATA_TYPE, &boolean, NULL },
+		{ "string ", 7, STRING_CONF_DATA_TYPE, &string, &length },
+		{ "integer", 7, FLOATING_CONF_DATA_TYPE, &integerFloating, NULL },
+		{ "missing", 7, BOOLEAN_CONF_DATA_TYPE, &missing, NULL },
+	};
+	if (sortedKeys)
+	{
+		// Note: reader key order is lexicographic.
+		ConfLookup unsortedLookups[6];
+		memcpy(unsortedLookups, lookups, sizeof(lookups));
+		lookups[0] = unsortedLookups[2]; lookups[1] = unsortedLookups[1];
+		lookups[2] = unsortedLookups[0]; lookups[3] = unsortedLookups[4];
+		lookups[4] = unsortedLookups[5]; lookups[5] = unsortedLookups[3];
+	}
+
+	uint64_t statusBits = 0;
+	size_t foundCount = getConfReaderBatch(confReader, lookups, 6, &statusBits);
+	destroyConfReader(confReader);
+
+	uint64_t expectedBits = 0;
+	for (size_t i = 0; i < 6; i++)
+	{
+		if (lookups[i].value != &missing)
+			expectedBits |= 1ull << i;
+	}
+
+	if (foundCount != 5 || statusBits != expectedBits || integer != 123456789 || floating != 0.123 ||
+		!boolean || length != strlen("Hello world!") || integerFloating != 123456789.0)
+	{
+		printf("testBatchLookup: incorrect values. (hash index: %d, sorted: %d)\n",
+			(int)buildHashIndex, (int)sortedKeys);
+		return false;
+	}
+	return true;
+}
+inline static bool testLargeBatchLookup()
+{
+	char* data = malloc(1000 * 16 + 1);
+	ConfLookup* lookups = malloc(2000 * sizeof(ConfLookup));
+	char* keys = malloc(2000 * 16);
+	int64_t* values = malloc(2000 * sizeof(int64_t));
+
+	if (!data || !lookups || !keys || !values)
+	{
+		printf("testLargeBatchLookup: failed to allocate data.\n");
+		free(data); free(lookups); free(keys); free(values);
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (int i = 0; i < 1000; i++)
+		dataSize += sprintf(data + dataSize, "key%d: %d\n", i * 2, i * 2);
+
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReaderN(data, dataSize, &confReader, &errorLine);
+	free(data);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testLargeBatchLookup: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		free(lookups); free(keys); free(values);
+		return false;
+	}
+
+	for (int i = 0; i < 2000; i++)
+	{
+		char* key = keys + i * 16;
+		int index = (i * 7) % 2000;
+		lookups[i].key = key;
+		lookups[i].keyLength = (size_t)sprintf(key, "key%d", index);
+		lookups[i].type = INTEGER_CONF_DATA_TYPE;
+		lookups[i].value = &values[i];
+		lookups[i].length = NULL;
+		values[i] = -1;
+	}
+
+	uint64_t statusBits[(2000 + 63) / 64];
+	size_t foundCount = getConfReaderBatch(confReader, lookups, 2000, statusBits);
+	destroyConfReader(confReader);
+
+	bool result = foundCount == 1000;
+	for (int i = 0; i < 2000 && result; i++)
+	{
+		int index = (i * 7) % 2000;
+		bool isFound = (statusBits[i / 64] >> (i % 64)) & 1u;
+		result = index % 2 == 0 ? isFound && values[i] == index : !isFound && values[i] == -1;
+	}
+
+	if (!result)
+		printf("testLargeBatchLookup: incorrect values.\n");
+
+	free(lookups); free(keys); free(values);
+	return result;
+}
+typedef struct TestSettings
+{
+	int32_t integer;
+	int8_t smallInteger;
+	float floating;
+	double integerFloating;
+	bool boolean;
+	const char* string;
+	int16_t missing;
+	bool mistyped;
+} TestSettings;
+
+static const ConfBinding testSettingsBindings[] =
+{
+	{ .key = "string ", .type = STRING_CONF_DATA_TYPE, .offset = offsetof(TestSettings, string),
+		.size = sizeof(const char*), .defaultValue.string = NULL },
+	{ .key = "integer", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestSettings, integer),
+		.size = sizeof(int32_t), .defaultValue.integer = 0 },
+	{ .key = "integer", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestSettings, smallInteger),
+		.size = sizeof(int8_t), .defaultValue.integer = 7 },
+	{ .key = "DOUBLE", .type = FLOATING_CONF_DATA_TYPE, .offset = offsetof(TestSettings, floating),
+		.size = sizeof(float), .defaultValue.floating = 0.0 },
+	{ .key = "integer", .type = FLOATING_CONF_DATA_TYPE, .offset = offsetof(TestSettings, integerFloating),
+		.size = sizeof(double), .defaultValue.floating = 0.0 },
+	{ .key = "Boolean", .type = BOOLEAN_CONF_DATA_TYPE, .offset = offsetof(TestSettings, boolean),
+		.size = sizeof(bool), .defaultValue.boolean = false },
+	{ .key = "missing", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestSettings, missing),
+		.size = sizeof(int16_t), .defaultValue.integer = -5 },
+	{ .key = "DOUBLE", .type = BOOLEAN_CONF_DATA_TYPE, .offset = offsetof(TestSettings, mistyped),
+		.size = sizeof(bool), .defaultValue.boolean = true },
+};
+
+typedef struct TestUnsignedSettings
+{
+	uint32_t large;
+	uint8_t negative;
+	int8_t signedNegative;
+	uint64_t largest;
+	ConfBoundString name;
+	const char* bareName;
+} TestUnsignedSettings;
+
+static const ConfBinding testUnsignedBindings[] =
+{
+	{ .key = "large", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestUnsignedSettings, large),
+		.size = sizeof(uint32_t), .defaultValue.integer = 0, .isUnsigned = true },
+	{ .key = "negative", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestUnsignedSettings, negative),
+		.size = sizeof(uint8_t), .defaultValue.integer = 9, .isUnsigned = true },
+	{ .key = "negative", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestUnsignedSettings, signedNegative),
+		.size = sizeof(int8_t), .defaultValue.integer = 0 },
+	{ .key = "largest", .type = INTEGER_CONF_DATA_TYPE, .offset = offsetof(TestUnsignedSettings, largest),
+		.size = sizeof(uint64_t), .defaultValue.integer = 0, .isUnsigned = true },
+	{ .key = "name", .type = STRING_CONF_DATA_TYPE, .offset = offsetof(TestUnsignedSettings, name),
+		.size = sizeof(ConfBoundString), .defaultValue.string = NULL },
+	{ .key = "name", .type = STRING_CONF_DATA_TYPE, .offset = offsetof(TestUnsignedSettings, bareName),
+		.size = sizeof(const char*), .defaultValue.string = "none" },
+};
+
+inline static bool testStructBinding()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(testConfigString, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testStructBinding: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	TestSettings settings;
+	memset(&settings, 0, sizeof(TestSettings));
+	uint64_t missingBits = 0, mistypedBits = 0;
+
+	size_t bindingCount = sizeof(testSettingsBindings) / sizeof(ConfBinding);
+	size_t boundCount = bindConfReaderStruct(confReader, testSettingsBindings,
+		bindingCount, &settings, &missingBits, &mistypedBits);
+
+	bool result = boundCount == 5 && missingBits == (1u << 6) && mistypedBits == ((1u << 2) | (1u << 7)) &&
+		settings.integer == 123456789 && settings.smallInteger == 7 && settings.floating == 0.123f &&
+		settings.integerFloating == 123456789.0 && settings.boolean && settings.string &&
+		strcmp(settings.string, "Hello world!") == 0 && settings.missing == -5 && settings.mistyped;
+	destroyConfReader(confReader);
+
+	// Note: borrowed strings are not null terminated, so only the ConfBoundString field is set.
+	const char* data = "large: 3000000000\nnegative: -1\nlargest: 9223372036854775807\nname: conf\nnext: 1";
+	if (createBorrowedDataConfReader(data, strlen(data), &confReader, &errorLine) != SUCCESS_CONF_RESULT)
+	{
+		printf("testStructBinding: failed to create borrowed reader.\n");
+		return false;
+	}
+
+	TestUnsignedSettings unsignedSettings;
+	memset(&unsignedSettings, 0, sizeof(TestUnsignedSettings));
+	bindingCount = sizeof(testUnsignedBindings) / sizeof(ConfBinding);
+	boundCount = bindConfReaderStruct(confReader, testUnsignedBindings,
+		bindingCount, &unsignedSettings, &missingBits, &mistypedBits);
+
+	result &= boundCount == 4 && missingBits == 0 && mistypedBits == ((1u << 1) | (1u << 5)) &&
+		unsignedSettings.large == 3000000000u && unsignedSettings.negative == 9 &&
+		unsignedSettings.signedNegative == -1 && unsignedSettings.largest == (uint64_t)INT64_MAX &&
+		unsignedSettings.name.length == 4 && memcmp(unsignedSettings.name.data, "conf", 4) == 0 &&
+		strcmp(unsignedSettings.bareName, "none") == 0;
+	destroyConfReader(confReader);
+
+	if (!result)
+	{
+		printf("testStructBinding: incorrect values. (bound: %llu)\n", (long long unsigned int)boundCount);
+		return false;
+	}
+	return true;
+}
+inline static bool testItemIteration()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(testConfigString, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testItemIteration: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	size_t itemCount = getConfReaderItemCount(confReader);
+	if (itemCount != 4)
+	{
+		printf("testItemIteration: incorrect item count. (%llu)\n", (long long unsigned int)itemCount);
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	int foundMask = 0;
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		const char* key; size_t keyLength; ConfDataType type;
+		getConfReaderItem(confReader, i, &key, &keyLength, &type);
+
+		int64_t integer; double floating; bool boolean;
+		const char* string; uint64_t length;
+
+		if (keyLength == 7 && memcmp(key, "integer", 7) == 0 && type == INTEGER_CONF_DATA_TYPE &&
+			getConfReaderIntAt(confReader, i, &integer) && integer == 123456789)
+		{
+			foundMask |= 1;
+		}
+		else if (keyLength == 6 && memcmp(key, "DOUBLE", 6) == 0 && type == FLOATING_CONF_DATA_TYPE &&
+			getConfReaderFloatAt(confReader, i, &floating) && floating == 0.123)
+		{
+			foundMask |= 2;
+		}
+		else if (keyLength == 7 && memcmp(key, "Boolean", 7) == 0 && type == BOOLEAN_CONF_DATA_TYPE &&
+			getConfReaderBoolAt(confReader, i, &boolean) && boolean)
+		{
+			foundMask |= 4;
+		}
+		else if (keyLength == 7 && memcmp(key, "string ", 7) == 0 && type == STRING_CONF_DATA_TYPE &&
+			getConfReaderStringAt(confReader, i, &string, &length) && length == strlen("Hello world!"))
+		{
+			foundMask |= 8;
+		}
+	}
+
+	// Note: out of range indices are reported instead of reading past the items.
+	const char* key; int64_t integer;
+	if (!getConfReaderItem(confReader, itemCount, &key, NULL, NULL) &&
+		!getConfReaderIntAt(confReader, itemCount, &integer) &&
+		getConfReaderTypeAt(confReader, SIZE_MAX) == CONF_DATA_TYPE_COUNT)
+	{
+		foundMask |= 16;
+	}
+
+	destroyConfReader(confReader);
+	if (foundMask != 31)
+	{
+		printf("testItemIteration: incorrect items. (mask: %d)\n", foundMask);
+		return false;
+	}
+	return true;
+}
+inline static bool testItemOrder()
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader("b: 1\naa: 2\na.b: 3\nab: 4\na: 5\n", &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testItemOrder: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	// Note: pinning the lexicographic order, shorter keys are not sorted first.
+	static const char* const orderedKeys[5] = { "a", "a.b", "aa", "ab", "b" };
+	bool result = getConfReaderItemCount(confReader) == 5;
+	for (size_t i = 0; i < 5 && result; i++)
+	{
+		const char* key; size_t keyLength;
+		result = getConfReaderItem(confReader, i, &key, &keyLength, NULL) &&
+			keyLength == strlen(orderedKeys[i]) && memcmp(key, orderedKeys[i], keyLength) == 0;
+	}
+	destroyConfReader(confReader);
+
+	if (!result)
+	{
+		printf("testItemOrder: incorrect item order.\n");
+		return false;
+	}
+	return true;
+}
+inline static bool testPrefixRange()
+{
+	const char* data =
+		"render.width: 1920\n"
+		"audio.volume: 0.5\n"
+		"render.height: 1080\n"
+		"render: true\n"
+		"renderer: vulkan\n"
+		"render.vsync: false\n"
+		"zoom: 2\n";
+
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(data, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testPrefixRange: incorrect result. "
+			"(result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+
+	size_t first, count;
+	bool result = findConfReaderPrefix(confReader, "render.", 7, &first, &count) && count == 3;
+	for (size_t i = 0; i < count && result; i++)
+	{
+		const char* key; size_t keyLength;
+		getConfReaderItem(confReader, first + i, &key, &keyLength, NULL);
+		result = keyLength > 7 && memcmp(key, "render.", 7) == 0;
+
+		if (i > 0)
+		{
+			const char* previousKey;
+			getConfReaderItem(confReader, first + i - 1, &previousKey, NULL, NULL);
+			result &= strcmp(previousKey, key) < 0;
+		}
+	}
+
+	result &= findConfReaderPrefix(confReader, "render", 6, &first, &count) && count == 5;
+	result &= findConfReaderPrefix(confReader, "", 0, &first, &count) && first == 0 && count == 7;
+	result &= !findConfReaderPrefix(confReader, "net.", 4, &first, &count) && count == 0;
+	result &= !findConfReaderPrefix(confReader, "zoom.", 5, &first, &count) && count == 0;
+	destroyConfReader(confReader);
+
+	if (!result)
+	{
+		printf("testPrefixRange: incorrect range.\n");
+		return false;
+	}
+	return true;
+}
+static const char* const testSectionString =
+	"version: 3\n"
+	"[net]\n"
+	"port: 8080\n"
+	"host: localhost\n"
+	"\n"
+	"[render]\n"
+	"width: 1920\n"
+	"# Comment inside section\n"
+	"[net.http]\n"
+	"timeout: 2.5\n"
+	"[render]\n"
+	"height: 1080\n"
+	"[renderer]\n"
+	"api: vulkan\n";
+
+inline static bool testSections(bool isBorrowed)
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	size_t dataSize = strlen(testSectionString);
+	ConfResult confResult = isBorrowed ?
+		createBorrowedDataConfReader(testSectionString, dataSize, &confReader, &errorLine) :
+		createDataConfReaderN(testSectionString, dataSize, &confReader, &errorLine);
+
+	if (confResult != (isBorrowed ? OWNED_DATA_CONF_RESULT : SUCCESS_CONF_RESULT))
+	{
+		printf("testSections: incorrect result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+
+	int64_t integer; double floating; const char* string; uint64_t length;
+	bool result = getConfReaderInt(confReader, "version", &integer) && integer == 3 &&
+		getConfReaderInt(confReader, "net.port", &integer) && integer == 8080 &&
+		getConfReaderFloat(confReader, "net.http.timeout", &floating) && floating == 2.5 &&
+		getConfReaderInt(confReader, "render.height", &integer) && integer == 1080 &&
+		!getConfReaderInt(confReader, "port", &integer);
+
+	ConfReader netSection, renderSection, missingSection;
+	result &= getConfReaderSection(confReader, "net", &netSection) &&
+		getConfReaderSection(confReader, "render", &renderSection) &&
+		!getConfReaderSection(confReader, "version", &missingSection) &&
+		!getConfReaderSection(confReader, "ne", &missingSection);
+
+	if (!result)
+	{
+		printf("testSections: failed to get values. (borrowed: %d)\n", (int)isBorrowed);
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	result = getConfReaderItemCount(netSection) == 3 && getConfReaderItemCount(renderSection) == 2 &&
+		getConfReaderInt(netSection, "port", &integer) && integer == 8080 &&
+		getConfReaderString(netSection, "host", &string, &length) && length == 9 && memcmp(string, "localhost", 9) == 0 &&
+		getConfReaderFloat(netSection, "http.timeout", &floating) && floating == 2.5 &&
+		getConfReaderInt(renderSection, "width", &integer) && integer == 1920 &&
+		!getConfReaderInt(renderSection, "port", &integer) && !getConfReaderInt(netSection, "net.port", &integer);
+
+	// Note: borrowed reader falls back to the owned data if config has sections.
+	result &= !isConfReaderBorrowed(confReader) && !isConfReaderBorrowed(netSection);
+
+	const char* key; size_t keyLength;
+	getConfReaderItem(renderSection, 0, &key, &keyLength, NULL);
+	result &= keyLength == 6 && memcmp(key, "height", 6) == 0;
+
+	ConfMemoryUsage memoryUsage, indexMemoryUsage;
+	getConfReaderMemoryUsage(confReader, &memoryUsage);
+	result &= memoryUsage.items > 0 && memoryUsage.data > 0 && memoryUsage.hashIndex == 0 &&
+		memoryUsage.sections > 0 && memoryUsage.mapped == 0;
+
+	result &= buildConfReaderHashIndex(netSection, 5) == SUCCESS_CONF_RESULT &&
+		getConfReaderInt(netSection, "port", &integer) && integer == 8080 &&
+		!getConfReaderInt(netSection, "net.port", &integer);
+
+	// Note: section view indices are owned by the parent reader.
+	getConfReaderMemoryUsage(confReader, &indexMemoryUsage);
+	result &= indexMemoryUsage.sections > memoryUsage.sections && indexMemoryUsage.hashIndex == 0;
+
+	destroyConfReader(netSection);
+	result &= getConfReaderInt(netSection, "port", &integer) && integer == 8080;
+	destroyConfReader(confReader);
+
+	if (!result)
+	{
+		printf("testSections: failed to get section values. (borrowed: %d)\n", (int)isBorrowed);
+		return false;
+	}
+	return true;
+}
+inline static bool testBadSection(const char* data, ConfResult expectedResult, size_t expectedLine)
+{
+	ConfReader confReader;
+	size_t errorLine;
+
+	ConfResult confResult = createDataConfReader(data, &confReader, &errorLine);
+	if (confResult == SUCCESS_CONF_RESULT)
+		destroyConfReader(confReader);
+
+	if (confResult != expectedResult || (confResult != SUCCESS_CONF_RESULT && errorLine != expectedLine))
+	{
+		printf("testBadSection: incorrect result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+inline static bool feedTestParser(ConfParser confParser, const char* data, size_t chunkSize, ConfReader* confReader)
+{
+	size_t dataSize = strlen(data), errorLine;
+	for (size_t offset = 0; offset < dataSize; offset += chunkSize)
+	{
+		size_t size = dataSize - offset < chunkSize ? dataSize - offset : chunkSize;
+		ConfResult confResult = feedConfParser(confParser, data + offset, size, &errorLine);
+		if (confResult != SUCCESS_CONF_RESULT)
+		{
+			printf("feedTestParser: failed to feed. (result: %s, line: %llu, chunk: %llu)\n",
+				confResultToString(confResult), (long long unsigned int)errorLine, (long long unsigned int)chunkSize);
+			return false;
+		}
+	}
+
+	ConfResult confResult = finishConfParser(confParser, confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("feedTestParser: failed to finish. (result: %s, line: %llu, chunk: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine, (long long unsigned int)chunkSize);
+		return false;
+	}
+	return true;
+}
+inline static bool testChunkedParser(size_t chunkSize)
+{
+	ConfParser confParser;
+	if (createConfParser(&confParser) != SUCCESS_CONF_RESULT)
+	{
+		printf("testChunkedParser: failed to create parser.\n");
+		return false;
+	}
+
+	ConfReader confReader;
+	if (!feedTestParser(confParser, testConfigString, chunkSize, &confReader))
+	{
+		destroyConfParser(confParser);
+		return false;
+	}
+
+	bool result = testConfig(confReader);
+	destroyConfReader(confReader);
+
+	// Note: reusing the same parser, last line has no new line symbol.
+	const char* data = "[net]\r\nport: 8080\r\n\r\n[render]\r\nwidth: 1920\r\nname: Main window";
+	if (!feedTestParser(confParser, data, chunkSize, &confReader))
+	{
+		destroyConfParser(confParser);
+		return false;
+	}
+	destroyConfParser(confParser);
+
+	int64_t integer; const char* string; uint64_t length; ConfReader section;
+	result &= getConfReaderItemCount(confReader) == 3 &&
+		getConfReaderInt(confReader, "net.port", &integer) && integer == 8080 &&
+		getConfReaderInt(confReader, "render.width", &integer) && integer == 1920 &&
+		getConfReaderString(confReader, "render.name", &string, &length) &&
+		length == 11 && strcmp(string, "Main window") == 0 &&
+		getConfReaderSection(confReader, "render", &section) && getConfReaderItemCount(section) == 2;
+	destroyConfReader(confReader);
+
+	if (!result)
+	{
+		printf("testChunkedParser: failed to get values. (chunk: %llu)\n", (long long unsigned int)chunkSize);
+		return false;
+	}
+	return true;
+}
+inline static bool testBadChunkedParser()
+{
+	ConfParser confParser;
+	if (createConfParser(&confParser) != SUCCESS_CONF_RESULT)
+	{
+		printf("testBadChunkedParser: failed to create parser.\n");
+		return false;
+	}
+
+	size_t errorLine;
+	ConfResult confResult = feedConfParser(confParser, "a: 1\nb: 2\nbad", 13, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testBadChunkedParser: incorrect partial result. (result: %s)\n", confResultToString(confResult));
+		destroyConfParser(confParser);
+		return false;
+	}
+
+	confResult = feedConfParser(confParser, "Line\nc: 3\n", 10, &errorLine);
+	if (confResult != BAD_ITEM_CONF_RESULT || errorLine != 3)
+	{
+		printf("testBadChunkedParser: incorrect result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		destroyConfParser(confParser);
+		return false;
+	}
+
+	ConfReader confReader;
+	confResult = finishConfParser(confParser, &confReader, &errorLine);
+	if (confResult != BAD_ITEM_CONF_RESULT || errorLine != 3)
+	{
+		printf("testBadChunkedParser: incorrect finish result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		destroyConfParser(confParser);
+		return false;
+	}
+
+	confResult = feedConfParser(confParser, "a: 1\na: 2", 9, &errorLine);
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = finishConfParser(confParser, &confReader, &errorLine);
+	destroyConfParser(confParser);
+
+	if (confResult != REPEATING_KEYS_CONF_RESULT || errorLine != 2)
+	{
+		printf("testBadChunkedParser: incorrect repeat result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+typedef struct TestStreamContext
+{
+	size_t itemCount;
+	size_t lastLine;
+	int64_t port;
+	double timeout;
+	bool hasHost;
+	bool isOrdered;
+} TestStreamContext;
+
+static void onTestStreamItem(const char* key, size_t keyLength, ConfDataType type,
+	const ConfItemValue* value, size_t line, void* context)
+{
+	TestStreamContext* streamContext = (TestStreamContext*)context;
+	streamContext->isOrdered &= line > streamContext->lastLine;
+	streamContext->lastLine = line;
+	streamContext->itemCount++;
+
+	if (keyLength == 8 && memcmp(key, "net.port", 8) == 0 && type == INTEGER_CONF_DATA_TYPE)
+		streamContext->port = value->integer;
+	else if (keyLength == 16 && memcmp(key, "net.http.timeout", 16) == 0 && type == FLOATING_CONF_DATA_TYPE)
+		streamContext->timeout = value->floating;
+	else if (keyLength == 8 && memcmp(key, "net.host", 8) == 0 && type == STRING_CONF_DATA_TYPE)
+		streamContext->hasHost = value->string.length == 9 && memcmp(value->string.data, "localhost", 9) == 0;
+}
+
+inline static bool testStreamParsing(bool checkRepeats)
+{
+	TestStreamContext context;
+	memset(&context, 0, sizeof(TestStreamContext));
+	context.isOrdered = true;
+
+	size_t errorLine;
+	ConfResult confResult = parseConfData(testSectionString, strlen(testSectionString),
+		onTestStreamItem, &context, checkRepeats, &errorLine);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testStreamParsing: incorrect result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+
+	if (context.itemCount != 7 || context.lastLine != 14 || !context.isOrdered ||
+		context.port != 8080 || context.timeout != 2.5 || !context.hasHost)
+	{
+		printf("testStreamParsing: incorrect items. (count: %llu, repeats: %d)\n",
+			(long long unsigned int)context.itemCount, (int)checkRepeats);
+		return false;
+	}
+	return true;
+}
+inline static bool testStreamRepeats()
+{
+	char* data = malloc(1001 * 16 + 32);
+	if (!data)
+	{
+		printf("testStreamRepeats: failed to allocate data.\n");
+		return false;
+	}
+
+	size_t dataSize = 0;
+	for (int i = 0; i < 1000; i++)
+		dataSize += sprintf(data + dataSize, "key%d: %d\n", i, i);
+	dataSize += sprintf(data + dataSize, "[key1]\nkey1: 1\n[key1]\nkey1: 2\n");
+
+	TestStreamContext context;
+	memset(&context, 0, sizeof(TestStreamContext));
+
+	size_t errorLine;
+	ConfResult confResult = parseConfData(data, dataSize, onTestStreamItem, &context, false, &errorLine);
+	bool result = confResult == SUCCESS_CONF_RESULT && context.itemCount == 1002;
+
+	memset(&context, 0, sizeof(TestStreamContext));
+	confResult = parseConfData(data, dataSize, onTestStreamItem, &context, true, &errorLine);
+	result &= confResult == REPEATING_KEYS_CONF_RESULT && errorLine == 1004 && context.itemCount == 1001;
+	free(data);
+
+	// Note: section keys are the same as dotted keys.
+	const char* sectionData = "net.port: 1\n[net]\nhost: a\nport: 2\n";
+	memset(&context, 0, sizeof(TestStreamContext));
+	confResult = parseConfData(sectionData, strlen(sectionData), onTestStreamItem, &context, true, &errorLine);
+	result &= confResult == REPEATING_KEYS_CONF_RESULT && errorLine == 4 && context.itemCount == 2;
+
+	if (!result)
+	{
+		printf("testStreamRepeats: incorrect result. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+typedef struct TestDiffContext
+{
+	char keys[8];
+	ConfChange changes[8];
+	size_t count;
+} TestDiffContext;
+
+static void onTestDiff(const char* key, size_t keyLength, const ConfDiff* diff, void* context)
+{
+	TestDiffContext* diffContext = (TestDiffContext*)context;
+	if (diffContext->count == 8 || keyLength != 1)
+		return;
+	diffContext->keys[diffContext->count] = key[0];
+	diffContext->changes[diffContext->count++] = diff->change;
+}
+
+inline static bool testReaderDiff()
+{
+	ConfReader oldReader, newReader, emptyReader; size_t errorLine;
+	const char* oldData = "a: 1\nb: x\nc: true\nd: 2.5\ne: nan\n[s]\nk: 1\n";
+	const char* newData = "a: 1\nb: y\nc: 1\ne: nan\nf: 3\n[s]\nk: 2\n";
+
+	if (createDataConfReader(oldData, &oldReader, &errorLine) != SUCCESS_CONF_RESULT)
+	{
+		printf("testReaderDiff: failed to create old reader.\n");
+		return false;
+	}
+	if (createDataConfReader(newData, &newReader, &errorLine) != SUCCESS_CONF_RESULT)
+	{
+		printf("testReaderDiff: failed to create new reader.\n");
+		destroyConfReader(oldReader);
+		return false;
+	}
+	if (createDataConfReader("", &emptyReader, &errorLine) != SUCCESS_CONF_RESULT)
+	{
+		printf("testReaderDiff: failed to create empty reader.\n");
+		destroyConfReader(newReader); destroyConfReader(oldReader);
+		return false;
+	}
+
+	TestDiffContext context;
+	memset(&context, 0, sizeof(TestDiffContext));
+	bool result = diffConfReaders(oldReader, newReader, onTestDiff, &context) == 5 && context.count == 4 &&
+		context.keys[0] == 'b' && context.changes[0] == CHANGED_CONF_CHANGE &&
+		context.keys[1] == 'c' && context.changes[1] == RETYPED_CONF_CHANGE &&
+		context.keys[2] == 'd' && context.changes[2] == REMOVED_CONF_CHANGE &&
+		context.keys[3] == 'f' && context.changes[3] == ADDED_CONF_CHANGE;
+
+	ConfDiff diff = { 0, 0, CONF_CHANGE_COUNT };
+	result &= nextConfReaderDiff(oldReader, newReader, &diff) && diff.change == CHANGED_CONF_CHANGE &&
+		diff.oldIndex == 1 && diff.newIndex == 1;
+	while (nextConfReaderDiff(oldReader, newReader, &diff)) { }
+	result &= !nextConfReaderDiff(oldReader, newReader, &diff);
+
+	// Note: section views are compared without the section prefix.
+	ConfReader oldSection, newSection;
+	memset(&context, 0, sizeof(TestDiffContext));
+	result &= getConfReaderSection(oldReader, "s", &oldSection) && getConfReaderSection(newReader, "s", &newSection) &&
+		diffConfReaders(oldSection, newSection, onTestDiff, &context) == 1 &&
+		context.keys[0] == 'k' && context.changes[0] == CHANGED_CONF_CHANGE;
+
+	memset(&context, 0, sizeof(TestDiffContext));
+	result &= diffConfReaders(oldReader, oldReader, onTestDiff, &context) == 0 &&
+		diffConfReaders(emptyReader, emptyReader, onTestDiff, &context) == 0 &&
+		diffConfReaders(emptyReader, newReader, onTestDiff, &context) == getConfReaderItemCount(newReader) &&
+		context.changes[0] == ADDED_CONF_CHANGE;
+
+	memset(&context, 0, sizeof(TestDiffContext));
+	result &= diffConfReaders(newReader, emptyReader, onTestDiff, &context) == getConfReaderItemCount(newReader) &&
+		context.changes[0] == REMOVED_CONF_CHANGE;
+
+	destroyConfReader(emptyReader);
+	destroyConfReader(newReader);
+	destroyConfReader(oldReader);
+
+	if (!result)
+	{
+		printf("testReaderDiff: incorrect differences. (count: %llu)\n", (long long unsigned int)context.count);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+inline static bool corruptTestImage(long offset, bool truncate)
+{
+	FILE* file = openFile(TEST_IMAGE_FILE_NAME, "rb");
+	if (!file)
+		return false;
+
+	char data[4096];
+	size_t size = fread(data, sizeof(char), sizeof(data), file);
+	closeFile(file);
+	if (size == 0 || offset < 0 || (size_t)offset >= size)
+		return false;
+
+	if (truncate)
+		size = (size_t)offset;
+	else
+		data[offset] ^= 0x20;
+
+	file = openFile(TEST_IMAGE_FILE_NAME, "wb");
+	if (!file)
+		return false;
+	bool result = fwrite(data, sizeof(char), size, file) == size;
+	closeFile(file);
+	return result;
+}
+
+inline static bool testImageReader()
+{
+	const char* data = "count: 42\nratio: 0.5\nvalue: nan\nenabled: true\nname: some text\n"
+		"[net]\nport: 8080\nhost: localhost\n";
+
+	ConfReader confReader; size_t errorLine;
+	if (createBorrowedDataConfReader(data, strlen(data), &confReader, &errorLine) != OWNED_DATA_CONF_RESULT)
+	{
+		printf("testImageReader: failed to create reader.\n");
+		return false;
+	}
+
+	ConfResult confResult = buildConfReaderHashIndex(confReader, 7);
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = writeConfReaderImage(confReader, TEST_IMAGE_FILE_NAME);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testImageReader: failed to write image. (%s)\n", confResultToString(confResult));
+		destroyConfReader(confReader);
+		return false;
+	}
+
+	ConfReader imageReader;
+	confResult = createImageConfReader(TEST_IMAGE_FILE_NAME, true, &imageReader);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testImageReader: failed to create image reader. (%s)\n", confResultToString(confResult));
+		destroyConfReader(confReader);
+		remove(TEST_IMAGE_FILE_NAME);
+		return false;
+	}
+
+	// Note: image items should be the same, and strings are null terminated.
+	int64_t integer; double floating; bool boolean; const char* string; uint64_t length; ConfReader section;
+	ConfDiff diff = { 0, 0, CONF_CHANGE_COUNT };
+	bool result = getConfReaderItemCount(imageReader) == getConfReaderItemCount(confReader) &&
+		!nextConfReaderDiff(confReader, imageReader, &diff) &&
+		getConfReaderInt(imageReader, "count", &integer) && integer == 42 &&
+		getConfReaderFloat(imageReader, "ratio", &floating) && floating == 0.5 &&
+		getConfReaderFloat(imageReader, "value", &floating) && isnan(floating) &&
+		getConfReaderBool(imageReader, "enabled", &boolean) && boolean &&
+		getConfReaderString(imageReader, "name", &string, &length) && strcmp(string, "some text") == 0 &&
+		getConfReaderSection(imageReader, "net", &section) && getConfReaderInt(section, "port", &integer) &&
+		integer == 8080 && getConfReaderString(section, "host", &string, &length) && strcmp(string, "localhost") == 0 &&
+		!getConfReaderSection(imageReader, "none", &section);
+
+	ConfMemoryUsage memoryUsage;
+	getConfReaderMemoryUsage(imageReader, &memoryUsage);
+	result &= memoryUsage.items > 0 && memoryUsage.data > 0 && memoryUsage.hashIndex > 0 &&
+		memoryUsage.items + memoryUsage.data + memoryUsage.hashIndex < memoryUsage.mapped;
+
+	// Note: mapped hash index is replaced with the allocated one.
+	result &= buildConfReaderHashIndex(imageReader, 0) == SUCCESS_CONF_RESULT &&
+		getConfReaderInt(imageReader, "net.port", &integer) && integer == 8080;
+	destroyConfReader(imageReader);
+	destroyConfReader(confReader);
+
+	// Note: corrupted padding is only detected with verification, header and item bounds are always checked.
+	result &= corruptTestImage(-1, false) == false && corruptTestImage(300, false) &&
+		createImageConfReader(TEST_IMAGE_FILE_NAME, true, &imageReader) == BAD_IMAGE_CONF_RESULT &&
+		createImageConfReader(TEST_IMAGE_FILE_NAME, false, &imageReader) == SUCCESS_CONF_RESULT;
+	if (result)
+		destroyConfReader(imageReader);
+
+	// Note: first item type, right after the 64 byte header and item key and value fields.
+	result &= corruptTestImage(64 + 32, false) &&
+		createImageConfReader(TEST_IMAGE_FILE_NAME, false, &imageReader) == BAD_IMAGE_CONF_RESULT;
+
+	result &= corruptTestImage(100, true) &&
+		createImageConfReader(TEST_IMAGE_FILE_NAME, false, &imageReader) == BAD_IMAGE_CONF_RESULT &&
+		corruptTestImage(10, true) &&
+		createImageConfReader(TEST_IMAGE_FILE_NAME, false, &imageReader) == BAD_IMAGE_CONF_RESULT;
+	remove(TEST_IMAGE_FILE_NAME);
+
+	ConfReader emptyReader;
+	result &= createImageConfReader(TEST_IMAGE_FILE_NAME, false, &imageReader) == FAILED_TO_OPEN_FILE_CONF_RESULT &&
+		createDataConfReader("", &emptyReader, &errorLine) == SUCCESS_CONF_RESULT;
+	if (result)
+	{
+		result = writeConfReaderImage(emptyReader, TEST_IMAGE_FILE_NAME) == SUCCESS_CONF_RESULT &&
+			createImageConfReader(TEST_IMAGE_FILE_NAME, true, &imageReader) == SUCCESS_CONF_RESULT;
+		if (result)
+		{
+			result = getConfReaderItemCount(imageReader) == 0 && !getConfReaderInt(imageReader, "count", &integer);
+			destroyConfReader(imageReader);
+		}
+		destroyConfReader(emptyReader);
+		remove(TEST_IMAGE_FILE_NAME);
+	}
+
+	if (!result)
+	{
+		printf("testImageReader: incorrect image values.\n");
+		return false;
+	}
+	return true;
+}
+
 //**********************************************************************************************************************
 int main()
 {
@@ -585,6 +1880,10 @@ int main()
 	result &= testBadKey();
 	result &= testBadValue();
 	result &= testBadValueSpacing();
+	result &= testRepeatingKeys("a: 1\nb: 2\n\n# c\na: 3\n", 5, 1);
+	result &= testRepeatingKeys("same: 1\nsame: 1", 2, 1);
+	result &= testRepeatingKeys("z: 1\nb: 2\na: 3\nb: x\n", 4, 2);
+	result &= testManyRepeatingKeys();
 	result &= testKey("someKey");
 	result &= testKey("StartFromBig");
 	result &= testKey("and.some.dots");
@@ -604,6 +1903,9 @@ int main()
 	result &= testInteger(-1000, "-1000");
 	result &= testInteger(123456789, "123456789");
 	result &= testInteger(-123456789, "-123456789");
+	result &= testInteger(INT64_MAX, "9223372036854775807");
+	result &= testInteger(INT64_MIN, "-9223372036854775808");
+	result &= testInteger(7, "0007");
 	result &= testFloating(0.0, "0.0");
 	result &= testFloating(1.0, "1.0");
 	result &= testFloating(-0.001, "-0.001");
@@ -617,6 +1919,16 @@ int main()
 	result &= testFloating(-0.0102, "-0.0102");
 	result &= testFloating(123456789.0, "123456789.0");
 	result &= testFloating(-123456789.0, "-123456789.0");
+	result &= testFloating(0.001, "1e-3");
+	result &= testFloating(-2.5e10, "-2.5E+10");
+	result &= testFloating(1e22, "1e22");
+	result &= testFloating(1.5e30, "15e29");
+	result &= testFloating(0.3, "0.29999999999999999");
+	result &= testFloating(0.1234567890123456789012345, "0.1234567890123456789012345");
+	result &= testFloating(123456789012345678.5, "123456789012345678.5");
+	result &= testFloating(9007199254740992.0, "9007199254740993.0");
+	result &= testFloating(1.7976931348623157e308, "1.7976931348623157e308");
+	result &= testFloating(4.9406564584124654e-324, "5e-324");
 	result &= testFloating(INFINITY, "INF");
 	result &= testFloating(-INFINITY, "-inf");
 	result &= testFloating(NAN, "NaN");
@@ -632,6 +1944,12 @@ int main()
 	result &= testString("-1.0f");
 	result &= testString("123x");
 	result &= testString("0x123");
+	result &= testString("9223372036854775808");
+	result &= testString("1e");
+	result &= testString("1.e5");
+	result &= testString("2e+");
+	result &= testString("--1");
+	result &= testString("1.5.5");
 	result &= testString("abcdef");
 	result &= testString("Hello!");
 	result &= testString("Some text test");
@@ -641,5 +1959,36 @@ int main()
 	result &= testString("!@#$%%^&*()_+-{}[]:|\";'\\<>?,./");
 	result &= testFileConfig();
 	result &= testDataConfig();
+	result &= testEmptyConfig();
+	result &= testSizedDataConfig();
+	result &= testLongLines();
+	result &= testBorrowedDataConfig();
+	result &= testHashIndex(0);
+	result &= testHashIndex(0x9E3779B97F4A7C15ull);
+	result &= testKeyHandles();
+	result &= testHashedKeys();
+	result &= testBatchLookup(false, false);
+	result &= testBatchLookup(false, true);
+	result &= testBatchLookup(true, false);
+	result &= testLargeBatchLookup();
+	result &= testStructBinding();
+	result &= testItemIteration();
+	result &= testItemOrder();
+	result &= testPrefixRange();
+	result &= testSections(false);
+	result &= testSections(true);
+	result &= testBadSection("[]\na: 1", BAD_KEY_CONF_RESULT, 1);
+	result &= testBadSection("a: 1\n[net\n", BAD_ITEM_CONF_RESULT, 2);
+	result &= testBadSection("[a]: 1\n", SUCCESS_CONF_RESULT, 0);
+	result &= testBadSection("net.port: 1\n[net]\nport: 2\n", REPEATING_KEYS_CONF_RESULT, 3);
+	result &= testChunkedParser(1);
+	result &= testChunkedParser(7);
+	result &= testChunkedParser(4096);
+	result &= testBadChunkedParser();
+	result &= testStreamParsing(false);
+	result &= testStreamParsing(true);
+	result &= testStreamRepeats();
+	result &= testReaderDiff();
+	result &= testImageReader();
 	return result ? EXIT_SUCCESS : EXIT_FAILURE;
 }
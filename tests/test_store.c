@@ -0,0 +1,219 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/store.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#if _WIN32
+#include <windows.h>
+typedef HANDLE TestThread;
+#define TEST_THREAD_RESULT DWORD WINAPI
+#define loadTestFlag(address) InterlockedOr(address, 0)
+#define storeTestFlag(address, value) InterlockedExchange(address, value)
+#else
+#include <pthread.h>
+typedef pthread_t TestThread;
+#define TEST_THREAD_RESULT void*
+#define loadTestFlag(address) __atomic_load_n(address, __ATOMIC_SEQ_CST)
+#define storeTestFlag(address, value) __atomic_store_n(address, value, __ATOMIC_SEQ_CST)
+#endif
+
+#define TEST_READER_THREAD_COUNT 4
+#define TEST_VERSION_COUNT 256
+
+inline static bool startTestThread(TestThread* thread, TEST_THREAD_RESULT(*function)(void*), void* argument)
+{
+	#if _WIN32
+	*thread = CreateThread(NULL, 0, function, argument, 0, NULL);
+	return *thread != NULL;
+	#else
+	return pthread_create(thread, NULL, function, argument) == 0;
+	#endif
+}
+inline static void joinTestThread(TestThread thread)
+{
+	#if _WIN32
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+	#else
+	pthread_join(thread, NULL);
+	#endif
+}
+
+inline static ConfReader createTestReader(int64_t version)
+{
+	char data[64];
+	int dataSize = sprintf(data, "first: %lld\nsecond: %lld\n", (long long int)version, (long long int)version);
+
+	ConfReader confReader;
+	if (createDataConfReaderN(data, (size_t)dataSize, &confReader, NULL) != SUCCESS_CONF_RESULT)
+		return NULL;
+	return confReader;
+}
+
+//**********************************************************************************************************************
+inline static bool testStoreSnapshots()
+{
+	ConfReader firstReader = createTestReader(1);
+	if (!firstReader)
+	{
+		printf("testStoreSnapshots: failed to create reader.\n");
+		return false;
+	}
+
+	ConfStore confStore;
+	if (createConfStore(firstReader, 2, &confStore) != SUCCESS_CONF_RESULT)
+	{
+		printf("testStoreSnapshots: failed to create store.\n");
+		destroyConfReader(firstReader);
+		return false;
+	}
+
+	size_t firstIndex, secondIndex, thirdIndex;
+	bool result = registerConfStoreReader(confStore, &firstIndex) &&
+		registerConfStoreReader(confStore, &secondIndex) &&
+		!registerConfStoreReader(confStore, &thirdIndex) && firstIndex != secondIndex;
+
+	ConfReader snapshot = acquireConfStoreSnapshot(confStore, firstIndex);
+	result &= snapshot == firstReader;
+
+	// Note: acquired snapshot stays valid after the new one is published.
+	ConfReader secondReader = createTestReader(2);
+	result &= secondReader && publishConfStore(confStore, secondReader) == SUCCESS_CONF_RESULT;
+	result &= reclaimConfStore(confStore) == 1;
+
+	int64_t value;
+	result &= getConfReaderInt(snapshot, "first", &value) && value == 1;
+	result &= acquireConfStoreSnapshot(confStore, secondIndex) == secondReader;
+	releaseConfStoreSnapshot(confStore, secondIndex);
+	releaseConfStoreSnapshot(confStore, firstIndex);
+	result &= reclaimConfStore(confStore) == 0;
+
+	unregisterConfStoreReader(confStore, secondIndex);
+	result &= registerConfStoreReader(confStore, &thirdIndex) && thirdIndex == secondIndex;
+
+	ConfReader thirdReader = createTestReader(3);
+	result &= thirdReader && publishConfStore(confStore, thirdReader) == SUCCESS_CONF_RESULT;
+	result &= reclaimConfStore(confStore) == 0;
+	destroyConfStore(confStore);
+
+	if (!result)
+	{
+		printf("testStoreSnapshots: incorrect snapshots.\n");
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+typedef struct TestStoreContext
+{
+	ConfStore confStore;
+	volatile long isRunning;
+	volatile long isFailed;
+} TestStoreContext;
+
+static TEST_THREAD_RESULT readTestStore(void* argument)
+{
+	TestStoreContext* context = (TestStoreContext*)argument;
+	ConfStore confStore = context->confStore;
+
+	size_t readerIndex;
+	if (!registerConfStoreReader(confStore, &readerIndex))
+	{
+		storeTestFlag(&context->isFailed, 1);
+		return 0;
+	}
+
+	int64_t lastVersion = 0;
+	while (loadTestFlag(&context->isRunning))
+	{
+		ConfReader snapshot = acquireConfStoreSnapshot(confStore, readerIndex);
+		int64_t first = -1, second = -2;
+		getConfReaderInt(snapshot, "first", &first);
+		getConfReaderInt(snapshot, "second", &second);
+		releaseConfStoreSnapshot(confStore, readerIndex);
+
+		// Note: values from one snapshot are always from the same version, versions never go back.
+		if (first != second || first < lastVersion)
+			storeTestFlag(&context->isFailed, 1);
+		lastVersion = first;
+	}
+
+	unregisterConfStoreReader(confStore, readerIndex);
+	return 0;
+}
+
+inline static bool testStoreThreads()
+{
+	ConfReader confReader = createTestReader(0);
+	if (!confReader)
+	{
+		printf("testStoreThreads: failed to create reader.\n");
+		return false;
+	}
+
+	TestStoreContext context;
+	if (createConfStore(confReader, TEST_READER_THREAD_COUNT, &context.confStore) != SUCCESS_CONF_RESULT)
+	{
+		printf("testStoreThreads: failed to create store.\n");
+		destroyConfReader(confReader);
+		return false;
+	}
+	context.isRunning = 1;
+	context.isFailed = 0;
+
+	TestThread threads[TEST_READER_THREAD_COUNT];
+	size_t threadCount = 0;
+	for (; threadCount < TEST_READER_THREAD_COUNT; threadCount++)
+	{
+		if (!startTestThread(&threads[threadCount], readTestStore, &context))
+			break;
+	}
+
+	bool result = threadCount == TEST_READER_THREAD_COUNT;
+	for (int64_t version = 1; version <= TEST_VERSION_COUNT && result; version++)
+	{
+		confReader = createTestReader(version);
+		result = confReader && publishConfStore(context.confStore, confReader) == SUCCESS_CONF_RESULT;
+		if (!result)
+			destroyConfReader(confReader);
+	}
+
+	storeTestFlag(&context.isRunning, 0);
+	for (size_t i = 0; i < threadCount; i++)
+		joinTestThread(threads[i]);
+
+	result &= !loadTestFlag(&context.isFailed) && reclaimConfStore(context.confStore) == 0;
+	destroyConfStore(context.confStore);
+
+	if (!result)
+	{
+		printf("testStoreThreads: inconsistent snapshots.\n");
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+int main()
+{
+	bool result = testStoreSnapshots();
+	result &= testStoreThreads();
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
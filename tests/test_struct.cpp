@@ -0,0 +1,132 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/reader.hpp"
+#include "conf/writer.hpp"
+
+#include <cfloat>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define TEST_FILE_NAME "testing-conf-struct.txt"
+
+struct TestSettings
+{
+	int32_t width = 0;
+	uint16_t port = 0;
+	float scale = 0.0f;
+	double ratio = 0.0;
+	double tiny = 0.0;
+	bool enabled = false;
+	std::string title;
+
+	static constexpr auto confFields = std::make_tuple(
+		conf::field("width", &TestSettings::width),
+		conf::field("port", &TestSettings::port),
+		conf::field("scale", &TestSettings::scale),
+		conf::field("ratio", &TestSettings::ratio),
+		conf::field("tiny", &TestSettings::tiny),
+		conf::field("enabled", &TestSettings::enabled),
+		conf::field("title", &TestSettings::title));
+};
+
+//**********************************************************************************************************************
+inline static bool testStructRoundTrip()
+{
+	TestSettings settings;
+	settings.width = -1280;
+	settings.port = 65535;
+	settings.scale = 1.0f / 3.0f;
+	settings.ratio = 0.1 + 0.2;
+	settings.tiny = DBL_MIN;
+	settings.enabled = true;
+	settings.title = "Some title";
+
+	TestSettings loaded;
+	try
+	{
+		{
+			conf::Writer writer(TEST_FILE_NAME);
+			writer.save(settings);
+		}
+
+		conf::Reader reader(std::filesystem::path(TEST_FILE_NAME));
+		if (reader.load(loaded) != 7)
+		{
+			printf("testStructRoundTrip: not all fields are loaded.\n");
+			remove(TEST_FILE_NAME);
+			return false;
+		}
+	}
+	catch (const conf::Error& error)
+	{
+		printf("testStructRoundTrip: %s\n", error.what());
+		remove(TEST_FILE_NAME);
+		return false;
+	}
+	remove(TEST_FILE_NAME);
+
+	// Note: floating values should have exactly the same bits after the round trip.
+	if (loaded.width != settings.width || loaded.port != settings.port ||
+		memcmp(&loaded.scale, &settings.scale, sizeof(float)) != 0 ||
+		memcmp(&loaded.ratio, &settings.ratio, sizeof(double)) != 0 ||
+		memcmp(&loaded.tiny, &settings.tiny, sizeof(double)) != 0 ||
+		loaded.enabled != settings.enabled || loaded.title != settings.title)
+	{
+		printf("testStructRoundTrip: incorrect loaded values. (ratio: %.17g, scale: %.9g)\n",
+			loaded.ratio, (double)loaded.scale);
+		return false;
+	}
+	return true;
+}
+inline static bool testEmptyStringField()
+{
+	TestSettings settings;
+	bool isThrown = false;
+
+	try
+	{
+		conf::Writer writer(TEST_FILE_NAME);
+		writer.save(settings);
+	}
+	catch (const conf::Error&)
+	{
+		isThrown = true;
+	}
+
+	try
+	{
+		conf::Writer writer(TEST_FILE_NAME);
+		writer.write("empty", std::string_view());
+		isThrown = false;
+	}
+	catch (const conf::Error&) { }
+	remove(TEST_FILE_NAME);
+
+	if (!isThrown)
+	{
+		printf("testEmptyStringField: empty string is written.\n");
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+int main()
+{
+	bool result = testStructRoundTrip();
+	result &= testEmptyStringField();
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
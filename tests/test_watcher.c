@@ -0,0 +1,302 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "conf/watcher.h"
+#include "mpio/file.h"
+
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#define TEST_FILE_NAME "testing-conf-watcher.txt"
+#define TEST_CHANGE_CAPACITY 16
+
+inline static bool createTestFile(const char* content)
+{
+	assert(content);
+
+	FILE* file = openFile(TEST_FILE_NAME, "w");
+	if (!file)
+	{
+		printf("Failed to open test file.\n");
+		return false;
+	}
+
+	size_t contentLength = strlen(content);
+	size_t writeResult = fwrite(content,
+		sizeof(char), contentLength, file);
+
+	if (writeResult != contentLength)
+	{
+		printf("Failed to write test file.\n");
+		closeFile(file);
+		return false;
+	}
+
+	closeFile(file);
+	return true;
+}
+inline static bool removeTestFile()
+{
+	int result = remove(TEST_FILE_NAME);
+
+	if (result != 0)
+	{
+		printf("Failed to remove test file.\n");
+		return false;
+	}
+
+	return true;
+}
+
+//**********************************************************************************************************************
+typedef struct TestChanges
+{
+	char keys[TEST_CHANGE_CAPACITY][32];
+	ConfChange changes[TEST_CHANGE_CAPACITY];
+	size_t count;
+} TestChanges;
+
+static void onTestChange(const char* key, size_t keyLength, ConfChange change,
+	ConfReader oldReader, ConfReader newReader, void* context)
+{
+	(void)oldReader; (void)newReader;
+	TestChanges* testChanges = (TestChanges*)context;
+	if (testChanges->count == TEST_CHANGE_CAPACITY || keyLength >= 32)
+		return;
+
+	memcpy(testChanges->keys[testChanges->count], key, keyLength);
+	testChanges->keys[testChanges->count][keyLength] = '\0';
+	testChanges->changes[testChanges->count++] = change;
+}
+inline static bool hasTestChange(const TestChanges* testChanges, const char* key, ConfChange change)
+{
+	for (size_t i = 0; i < testChanges->count; i++)
+	{
+		if (strcmp(testChanges->keys[i], key) == 0)
+			return testChanges->changes[i] == change;
+	}
+	return false;
+}
+
+//**********************************************************************************************************************
+inline static bool testWatcherUpdate()
+{
+	if (!createTestFile("a: 1\nb: hello\nc: true\nd: 1.5\nf: nan\n"))
+		return false;
+
+	ConfWatcher confWatcher; size_t errorLine;
+	ConfResult confResult = createConfWatcher(TEST_FILE_NAME, &confWatcher, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testWatcherUpdate: failed to create watcher. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		removeTestFile();
+		return false;
+	}
+
+	TestChanges allChanges, netChanges;
+	memset(&allChanges, 0, sizeof(TestChanges));
+	memset(&netChanges, 0, sizeof(TestChanges));
+
+	bool isReloaded = true;
+	bool result = addConfWatcherCallback(confWatcher, "", onTestChange, &allChanges) == SUCCESS_CONF_RESULT &&
+		addConfWatcherCallback(confWatcher, "net.", onTestChange, &netChanges) == SUCCESS_CONF_RESULT &&
+		updateConfWatcher(confWatcher, &isReloaded, &errorLine) == SUCCESS_CONF_RESULT && !isReloaded;
+
+	result &= createTestFile("a: 1\nb: world\nd: 1.5\ne: 5\nf: nan\n[net]\nport: 80\n");
+	confResult = updateConfWatcher(confWatcher, &isReloaded, &errorLine);
+
+	int64_t integer;
+	result &= confResult == SUCCESS_CONF_RESULT && isReloaded && allChanges.count == 4 &&
+		hasTestChange(&allChanges, "b", CHANGED_CONF_CHANGE) && hasTestChange(&allChanges, "c", REMOVED_CONF_CHANGE) &&
+		hasTestChange(&allChanges, "e", ADDED_CONF_CHANGE) && hasTestChange(&allChanges, "net.port", ADDED_CONF_CHANGE) &&
+		netChanges.count == 1 && hasTestChange(&netChanges, "net.port", ADDED_CONF_CHANGE) &&
+		getConfReaderInt(getConfWatcherReader(confWatcher), "net.port", &integer) && integer == 80;
+
+	result &= updateConfWatcher(confWatcher, &isReloaded, &errorLine) == SUCCESS_CONF_RESULT && !isReloaded;
+	destroyConfWatcher(confWatcher);
+	removeTestFile();
+
+	if (!result)
+	{
+		printf("testWatcherUpdate: incorrect changes. (result: %s, count: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)allChanges.count);
+		return false;
+	}
+	return true;
+}
+inline static bool testWatcherReload()
+{
+	if (!createTestFile("a: 1\nb: 2\n"))
+		return false;
+
+	ConfWatcher confWatcher; size_t errorLine;
+	ConfResult confResult = createConfWatcher(TEST_FILE_NAME, &confWatcher, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testWatcherReload: failed to create watcher. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		removeTestFile();
+		return false;
+	}
+
+	TestChanges changes;
+	memset(&changes, 0, sizeof(TestChanges));
+
+	// Note: invalid file content keeps the current reader.
+	int64_t integer;
+	bool result = addConfWatcherCallback(confWatcher, "", onTestChange, &changes) == SUCCESS_CONF_RESULT &&
+		createTestFile("a: 1\nb 2\n");
+	confResult = reloadConfWatcher(confWatcher, &errorLine);
+	result &= confResult == BAD_ITEM_CONF_RESULT && errorLine == 2 && changes.count == 0 &&
+		getConfReaderInt(getConfWatcherReader(confWatcher), "b", &integer) && integer == 2;
+
+	result &= createTestFile("a: one\nb: 2\n");
+	confResult = reloadConfWatcher(confWatcher, &errorLine);
+	result &= confResult == SUCCESS_CONF_RESULT && changes.count == 1 &&
+		hasTestChange(&changes, "a", RETYPED_CONF_CHANGE);
+
+	destroyConfWatcher(confWatcher);
+	removeTestFile();
+
+	if (!result)
+	{
+		printf("testWatcherReload: incorrect result. (result: %s, count: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)changes.count);
+		return false;
+	}
+	return true;
+}
+inline static bool testWatcherStore()
+{
+	if (!createTestFile("a: 1\n"))
+		return false;
+
+	ConfWatcher confWatcher; size_t errorLine;
+	ConfResult confResult = createConfWatcher(TEST_FILE_NAME, &confWatcher, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testWatcherStore: failed to create watcher. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		removeTestFile();
+		return false;
+	}
+
+	ConfStore confStore; size_t readerIndex, otherIndex;
+	confResult = createConfWatcherStore(confWatcher, 1, &confStore);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testWatcherStore: failed to create store. (result: %s)\n", confResultToString(confResult));
+		destroyConfWatcher(confWatcher);
+		removeTestFile();
+		return false;
+	}
+
+	// Note: acquired snapshot stays valid after the reload, until it's released.
+	int64_t integer;
+	bool result = registerConfStoreReader(confStore, &readerIndex) && !registerConfStoreReader(confStore, &otherIndex);
+	ConfReader oldSnapshot = acquireConfStoreSnapshot(confStore, readerIndex);
+
+	result &= createTestFile("a: 2\n");
+	confResult = reloadConfWatcher(confWatcher, &errorLine);
+	result &= confResult == SUCCESS_CONF_RESULT && getConfReaderInt(oldSnapshot, "a", &integer) && integer == 1 &&
+		reclaimConfStore(confStore) == 1;
+	releaseConfStoreSnapshot(confStore, readerIndex);
+
+	ConfReader newSnapshot = acquireConfStoreSnapshot(confStore, readerIndex);
+	result &= newSnapshot == getConfWatcherReader(confWatcher) &&
+		getConfReaderInt(newSnapshot, "a", &integer) && integer == 2;
+	releaseConfStoreSnapshot(confStore, readerIndex);
+	result &= reclaimConfStore(confStore) == 0;
+
+	// Note: store can outlive the watcher, watcher reader slot is released.
+	destroyConfWatcher(confWatcher);
+	result &= registerConfStoreReader(confStore, &otherIndex);
+	newSnapshot = acquireConfStoreSnapshot(confStore, otherIndex);
+	result &= getConfReaderInt(newSnapshot, "a", &integer) && integer == 2;
+	releaseConfStoreSnapshot(confStore, otherIndex);
+	destroyConfStore(confStore);
+	removeTestFile();
+
+	if (!result)
+	{
+		printf("testWatcherStore: incorrect result. (result: %s)\n", confResultToString(confResult));
+		return false;
+	}
+	return true;
+}
+inline static bool testWatcherRetry()
+{
+	if (!createTestFile("a: 1\nb: hello\n"))
+		return false;
+
+	ConfWatcher confWatcher; size_t errorLine;
+	ConfResult confResult = createConfWatcher(TEST_FILE_NAME, &confWatcher, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testWatcherRetry: failed to create watcher. (result: %s, line: %llu)\n",
+			confResultToString(confResult), (long long unsigned int)errorLine);
+		removeTestFile();
+		return false;
+	}
+
+	// Note: half-written file should be read again, even if there are no new file changes.
+	bool isReloaded = true;
+	bool result = createTestFile("a: 2\nb\n");
+	result &= updateConfWatcher(confWatcher, &isReloaded, &errorLine) != SUCCESS_CONF_RESULT && !isReloaded;
+	result &= updateConfWatcher(confWatcher, &isReloaded, &errorLine) != SUCCESS_CONF_RESULT && !isReloaded;
+
+	int64_t integer;
+	result &= getConfReaderInt(getConfWatcherReader(confWatcher), "a", &integer) && integer == 1;
+
+	result &= createTestFile("a: 2\nb: world\n");
+	result &= updateConfWatcher(confWatcher, &isReloaded, &errorLine) == SUCCESS_CONF_RESULT && isReloaded &&
+		getConfReaderInt(getConfWatcherReader(confWatcher), "a", &integer) && integer == 2;
+	result &= updateConfWatcher(confWatcher, &isReloaded, &errorLine) == SUCCESS_CONF_RESULT && !isReloaded;
+
+	destroyConfWatcher(confWatcher);
+	removeTestFile();
+
+	if (!result)
+	{
+		printf("testWatcherRetry: failed reload is not retried.\n");
+		return false;
+	}
+	return true;
+}
+inline static bool testWatcherMissingFile()
+{
+	ConfWatcher confWatcher; size_t errorLine;
+	ConfResult confResult = createConfWatcher("not-existing-conf-file.txt", &confWatcher, &errorLine);
+	if (confResult != FAILED_TO_OPEN_FILE_CONF_RESULT)
+	{
+		printf("testWatcherMissingFile: incorrect result. (result: %s)\n", confResultToString(confResult));
+		if (confResult == SUCCESS_CONF_RESULT)
+			destroyConfWatcher(confWatcher);
+		return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+int main()
+{
+	bool result = testWatcherUpdate();
+	result &= testWatcherReload();
+	result &= testWatcherStore();
+	result &= testWatcherRetry();
+	result &= testWatcherMissingFile();
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
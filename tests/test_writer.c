@@ -13,9 +13,11 @@
 // limitations under the License.
 
 #include "conf/writer.h"
+#include "conf/reader.h"
 #include "mpio/file.h"
 
 #include <math.h>
+#include <float.h>
 #include <string.h>
 #include <assert.h>
 #include <stdlib.h>
@@ -137,6 +139,37 @@ inline static bool testComment()
 
 	return removeTestFile();
 }
+inline static bool testSection()
+{
+	ConfWriter confWriter;
+	ConfResult confResult = createFileConfWriter(TEST_FILE_NAME, &confWriter);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testSection: "
+			"incorrect result. (%s)\n",
+			confResultToString(confResult));
+		return false;
+	}
+
+	bool result = writeConfSection(confWriter, "net");
+	result &= writeConfInt(confWriter, "port", 80);
+	if (!result)
+	{
+		printf("testSection: failed to write value.\n");
+		destroyConfWriter(confWriter);
+		return false;
+	}
+
+	destroyConfWriter(confWriter);
+
+	if (!compareTestFile("[net]\nport: 80\n"))
+	{
+		printf("testSection: incorrect value.\n");
+		return false;
+	}
+
+	return removeTestFile();
+}
 inline static bool testInteger(int64_t value, const char* stringValue)
 {
 	assert(stringValue);
@@ -177,7 +210,7 @@ inline static bool testInteger(int64_t value, const char* stringValue)
 }
 
 //**********************************************************************************************************************
-inline static bool testFloating(double value, const char* stringValue)
+inline static bool testFloating(double value, uint8_t precision, const char* stringValue)
 {
 	assert(stringValue);
 
@@ -192,7 +225,7 @@ inline static bool testFloating(double value, const char* stringValue)
 	}
 
 	const char* keyName = "someFloating";
-	bool result = writeConfFloat(confWriter, keyName, value, 0);
+	bool result = writeConfFloat(confWriter, keyName, value, precision);
 	if (!result)
 	{
 		printf("testFloating: failed to write value. "
@@ -215,6 +248,38 @@ inline static bool testFloating(double value, const char* stringValue)
 
 	return removeTestFile();
 }
+inline static bool testFloatingRoundTrip(double value)
+{
+	ConfWriter confWriter;
+	ConfResult confResult = createFileConfWriter(TEST_FILE_NAME, &confWriter);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		printf("testFloatingRoundTrip: incorrect result. "
+			"(value: %.17g, result: %s)\n", value, confResultToString(confResult));
+		return false;
+	}
+
+	bool result = writeConfFloat(confWriter, "someFloating", value, 0);
+	destroyConfWriter(confWriter);
+
+	// Note: read value should have exactly the same bits.
+	ConfReader confReader; size_t errorLine; double floating = 0.0;
+	result &= createFileConfReader(TEST_FILE_NAME, &confReader, &errorLine) == SUCCESS_CONF_RESULT;
+	if (result)
+	{
+		result = getConfReaderFloat(confReader, "someFloating", &floating) &&
+			memcmp(&floating, &value, sizeof(double)) == 0;
+		destroyConfReader(confReader);
+	}
+
+	if (!result)
+	{
+		printf("testFloatingRoundTrip: incorrect value. "
+			"(value: %.17g, result: %.17g)\n", value, floating);
+		return false;
+	}
+	return removeTestFile();
+}
 inline static bool testBoolean(bool value, const char* stringValue)
 {
 	assert(stringValue);
@@ -386,6 +451,7 @@ inline static bool testConfig()
 int main()
 {
 	bool result = testComment();
+	result &= testSection();
 	result &= testInteger(0, "0");
 	result &= testInteger(1, "1");
 	result &= testInteger(-1, "-1");
@@ -394,21 +460,34 @@ int main()
 	result &= testInteger(-1000, "-1000");
 	result &= testInteger(123456789, "123456789");
 	result &= testInteger(-123456789, "-123456789");
-	result &= testFloating(0.0, "0.0");
-	result &= testFloating(1.0, "1.0");
-	result &= testFloating(-0.002, "-0.002");
-	result &= testFloating(-123.0, "-123.0");
-	result &= testFloating(321.0, "321.0");
-	result &= testFloating(10.1, "10.1");
-	result &= testFloating(123.4567, "123.4567");
-	result &= testFloating(-123.4567, "-123.4567");
-	result &= testFloating(0.0102, "0.0102");
-	result &= testFloating(-0.0102, "-0.0102");
-	result &= testFloating(123456789.0, "123456789.0");
-	result &= testFloating(-123456789.0, "-123456789.0");
-	result &= testFloating(INFINITY, "inf");
-	result &= testFloating(-INFINITY, "-inf");
-	result &= testFloating(NAN, "nan");
+	result &= testFloating(0.0, 0, "0.0");
+	result &= testFloating(1.0, 0, "1.0");
+	result &= testFloating(-0.002, 0, "-0.002");
+	result &= testFloating(-123.0, 0, "-123.0");
+	result &= testFloating(321.0, 0, "321.0");
+	result &= testFloating(10.1, 0, "10.1");
+	result &= testFloating(123.4567, 0, "123.4567");
+	result &= testFloating(-123.4567, 0, "-123.4567");
+	result &= testFloating(0.0102, 0, "0.0102");
+	result &= testFloating(-0.0102, 0, "-0.0102");
+	result &= testFloating(123456789.0, 0, "123456789.0");
+	result &= testFloating(-123456789.0, 0, "-123456789.0");
+	result &= testFloating(INFINITY, 0, "inf");
+	result &= testFloating(-INFINITY, 0, "-inf");
+	result &= testFloating(NAN, 0, "nan");
+	result &= testFloating(1.0e20, 0, "1e+20");
+	result &= testFloating(2.0 / 3.0, 0, "0.6666666666666666");
+	result &= testFloating(2.0 / 3.0, 2, "0.67");
+	result &= testFloating(1.5, 3, "1.5");
+	result &= testFloating(-1.0e19, 2, "-10000000000000000000.0");
+	result &= testFloatingRoundTrip(0.1);
+	result &= testFloatingRoundTrip(0.1 + 0.2);
+	result &= testFloatingRoundTrip(-0.0);
+	result &= testFloatingRoundTrip(1.0 / 3.0);
+	result &= testFloatingRoundTrip(3.0e19);
+	result &= testFloatingRoundTrip(DBL_MAX);
+	result &= testFloatingRoundTrip(DBL_MIN);
+	result &= testFloatingRoundTrip(5.0e-324);
 	result &= testBoolean(true, "true");
 	result &= testBoolean(false, "false");
 	result &= testString(" 123");
@@ -0,0 +1,500 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * Conf command line tool. Validates, dumps, compiles and benchmarks Conf files.
+ */
+
+#include "conf/reader.h"
+#include "mpio/file.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <stdlib.h>
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define CONFC_LOOKUP_COUNT 1000000
+
+static const char* const confDataTypeNames[CONF_DATA_TYPE_COUNT] = {
+	"integer",
+	"floating",
+	"boolean",
+	"string",
+};
+
+inline static double getToolTime()
+{
+#if _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (double)time.tv_sec + (double)time.tv_nsec / 1000000000.0;
+#endif
+}
+
+/*
+ * Loads binary image if the file is a valid one, otherwise parses it as a text config.
+ */
+inline static bool loadToolReader(const char* filePath, ConfReader* confReader, bool* isImage)
+{
+	ConfResult confResult = createImageConfReader(filePath, true, confReader);
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		if (isImage)
+			*isImage = true;
+		return true;
+	}
+	if (confResult != BAD_IMAGE_CONF_RESULT)
+	{
+		fprintf(stderr, "%s: %s.\n", filePath, confResultToString(confResult));
+		return false;
+	}
+
+	size_t errorLine;
+	confResult = createFileConfReader(filePath, confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		fprintf(stderr, "%s:%llu: %s.\n", filePath, (long long unsigned int)errorLine, confResultToString(confResult));
+		return false;
+	}
+
+	if (isImage)
+		*isImage = false;
+	return true;
+}
+
+//**********************************************************************************************************************
+inline static bool writeToolFloat(FILE* file, double value)
+{
+	if (isnan(value))
+		return fputs("nan", file) >= 0;
+	if (isinf(value))
+		return fputs(value < 0.0 ? "-inf" : "inf", file) >= 0;
+
+	// Note: using the shortest representation that is read back to the same value.
+	char buffer[32];
+	for (int precision = 15; precision <= 17; precision++)
+	{
+		snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+		if (strtod(buffer, NULL) == value)
+			break;
+	}
+
+	// Note: value without a point or exponent would be read as an integer.
+	if (!strpbrk(buffer, ".eE"))
+		strcat(buffer, ".0");
+	return fputs(buffer, file) >= 0;
+}
+
+inline static bool writeToolItems(FILE* file, ConfReader confReader)
+{
+	size_t itemCount = getConfReaderItemCount(confReader);
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		const char* key; size_t keyLength; ConfDataType type;
+		getConfReaderItem(confReader, i, &key, &keyLength, &type);
+		if (fprintf(file, "%.*s: ", (int)keyLength, key) < 0)
+			return false;
+
+		bool result;
+		switch (type)
+		{
+		case INTEGER_CONF_DATA_TYPE:
+		{
+			int64_t value;
+			getConfReaderIntAt(confReader, i, &value);
+			result = fprintf(file, "%lld", (long long int)value) >= 0;
+			break;
+		}
+		case FLOATING_CONF_DATA_TYPE:
+		{
+			double value;
+			getConfReaderFloatAt(confReader, i, &value);
+			result = writeToolFloat(file, value);
+			break;
+		}
+		case BOOLEAN_CONF_DATA_TYPE:
+		{
+			bool value;
+			getConfReaderBoolAt(confReader, i, &value);
+			result = fputs(value ? "true" : "false", file) >= 0;
+			break;
+		}
+		case STRING_CONF_DATA_TYPE:
+		{
+			const char* value; uint64_t length;
+			getConfReaderStringAt(confReader, i, &value, &length);
+			result = fwrite(value, sizeof(char), (size_t)length, file) == (size_t)length;
+			break;
+		}
+		default:
+			assert(false); // Unknown Conf data type.
+			return false;
+		}
+
+		if (!result || fputc('\n', file) == EOF)
+			return false;
+	}
+	return true;
+}
+
+//**********************************************************************************************************************
+typedef struct ToolItem
+{
+	char* key;
+	size_t keyLength;
+	size_t line;
+	ConfDataType type;
+} ToolItem;
+
+typedef struct ToolItems
+{
+	ToolItem* items;
+	size_t count;
+	size_t capacity;
+	bool isFailed;
+} ToolItems;
+
+static void onToolItem(const char* key, size_t keyLength, ConfDataType type,
+	const ConfItemValue* value, size_t line, void* context)
+{
+	(void)value;
+	ToolItems* toolItems = (ToolItems*)context;
+	if (toolItems->isFailed)
+		return;
+
+	if (toolItems->count == toolItems->capacity)
+	{
+		size_t capacity = toolItems->capacity > 0 ? toolItems->capacity * 2 : 64;
+		ToolItem* items = realloc(toolItems->items, capacity * sizeof(ToolItem));
+		if (!items)
+		{
+			toolItems->isFailed = true;
+			return;
+		}
+
+		toolItems->items = items;
+		toolItems->capacity = capacity;
+	}
+
+	char* keyCopy = malloc(keyLength + 1);
+	if (!keyCopy)
+	{
+		toolItems->isFailed = true;
+		return;
+	}
+	memcpy(keyCopy, key, keyLength);
+	keyCopy[keyLength] = '\0';
+
+	ToolItem* item = &toolItems->items[toolItems->count++];
+	item->key = keyCopy;
+	item->keyLength = keyLength;
+	item->line = line;
+	item->type = type;
+}
+static int compareToolItems(const void* a, const void* b)
+{
+	const ToolItem* itemA = (const ToolItem*)a;
+	const ToolItem* itemB = (const ToolItem*)b;
+	int result = strcmp(itemA->key, itemB->key);
+	if (result != 0)
+		return result;
+	return itemA->line < itemB->line ? -1 : (itemA->line > itemB->line ? 1 : 0);
+}
+
+/*
+ * Reports syntax error, all duplicate keys and item count of each type.
+ */
+static int validateConfFile(const char* filePath, bool printTypes)
+{
+	ToolItems toolItems;
+	memset(&toolItems, 0, sizeof(ToolItems));
+
+	size_t errorLine;
+	ConfResult confResult = parseConfFile(filePath, onToolItem, &toolItems, false, &errorLine);
+	if (confResult == SUCCESS_CONF_RESULT && toolItems.isFailed)
+		confResult = FAILED_TO_ALLOCATE_CONF_RESULT;
+
+	size_t itemCount = toolItems.count, duplicateCount = 0;
+	ToolItem* items = toolItems.items;
+	if (confResult == SUCCESS_CONF_RESULT)
+	{
+		if (itemCount > 0)
+			qsort(items, itemCount, sizeof(ToolItem), compareToolItems);
+
+		for (size_t i = 1; i < itemCount; i++)
+		{
+			if (strcmp(items[i - 1].key, items[i].key) != 0)
+				continue;
+
+			printf("%s:%llu: Repeating key \"%s\" (first at line %llu, %s and %s).\n", filePath,
+				(long long unsigned int)items[i].line, items[i].key, (long long unsigned int)items[i - 1].line,
+				confDataTypeNames[items[i - 1].type], confDataTypeNames[items[i].type]);
+			duplicateCount++;
+		}
+	}
+	else
+	{
+		fprintf(stderr, "%s:%llu: %s.\n", filePath, (long long unsigned int)errorLine, confResultToString(confResult));
+	}
+
+	size_t typeCounts[CONF_DATA_TYPE_COUNT] = { 0 };
+	for (size_t i = 0; i < itemCount; i++)
+	{
+		if (printTypes && confResult == SUCCESS_CONF_RESULT)
+			printf("%s: %s\n", items[i].key, confDataTypeNames[items[i].type]);
+		typeCounts[items[i].type]++;
+		free(items[i].key);
+	}
+	free(items);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+		return EXIT_FAILURE;
+
+	printf("%s: %llu items (%llu integer, %llu floating, %llu boolean, %llu string), %llu repeating keys.\n",
+		filePath, (long long unsigned int)itemCount, (long long unsigned int)typeCounts[INTEGER_CONF_DATA_TYPE],
+		(long long unsigned int)typeCounts[FLOATING_CONF_DATA_TYPE],
+		(long long unsigned int)typeCounts[BOOLEAN_CONF_DATA_TYPE],
+		(long long unsigned int)typeCounts[STRING_CONF_DATA_TYPE], (long long unsigned int)duplicateCount);
+	return duplicateCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//**********************************************************************************************************************
+static int dumpConfFile(const char* filePath)
+{
+	ConfReader confReader;
+	if (!loadToolReader(filePath, &confReader, NULL))
+		return EXIT_FAILURE;
+
+	bool result = writeToolItems(stdout, confReader);
+	destroyConfReader(confReader);
+	return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int compileConfFile(const char* filePath, const char* imagePath)
+{
+	ConfReader confReader; size_t errorLine;
+	ConfResult confResult = createFileConfReader(filePath, &confReader, &errorLine);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		fprintf(stderr, "%s:%llu: %s.\n", filePath, (long long unsigned int)errorLine, confResultToString(confResult));
+		return EXIT_FAILURE;
+	}
+
+	// Note: image stores the hash index, so lookups are fast right after the load.
+	confResult = buildConfReaderHashIndex(confReader, 0);
+	if (confResult == SUCCESS_CONF_RESULT)
+		confResult = writeConfReaderImage(confReader, imagePath);
+	destroyConfReader(confReader);
+
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		fprintf(stderr, "%s: %s.\n", imagePath, confResultToString(confResult));
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+static int decompileConfImage(const char* imagePath, const char* filePath)
+{
+	ConfReader confReader;
+	ConfResult confResult = createImageConfReader(imagePath, true, &confReader);
+	if (confResult != SUCCESS_CONF_RESULT)
+	{
+		fprintf(stderr, "%s: %s.\n", imagePath, confResultToString(confResult));
+		return EXIT_FAILURE;
+	}
+
+	FILE* file = openFile(filePath, "w");
+	if (!file)
+	{
+		destroyConfReader(confReader);
+		fprintf(stderr, "%s: %s.\n", filePath, confResultToString(FAILED_TO_OPEN_FILE_CONF_RESULT));
+		return EXIT_FAILURE;
+	}
+
+	bool result = writeToolItems(file, confReader) && fflush(file) == 0;
+	closeFile(file);
+	destroyConfReader(confReader);
+
+	if (!result)
+	{
+		fprintf(stderr, "%s: %s.\n", filePath, confResultToString(FAILED_TO_WRITE_FILE_CONF_RESULT));
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+//**********************************************************************************************************************
+inline static double measureToolLookups(ConfReader confReader, size_t* checksum)
+{
+	size_t itemCount = getConfReaderItemCount(confReader);
+	size_t roundCount = CONFC_LOOKUP_COUNT / itemCount + 1, found = 0;
+
+	double startTime = getToolTime();
+	for (size_t round = 0; round < roundCount; round++)
+	{
+		for (size_t i = 0; i < itemCount; i++)
+		{
+			const char* key; size_t keyLength, handle;
+			getConfReaderItem(confReader, i, &key, &keyLength, NULL);
+			found += resolveConfReaderKey(confReader, key, keyLength, &handle);
+		}
+	}
+	double time = getToolTime() - startTime;
+
+	*checksum = found;
+	return time * 1000000000.0 / (double)(roundCount * itemCount);
+}
+
+/*
+ * Reports parse time, reader memory usage and key lookup latency of the config file.
+ */
+static int benchmarkConfFile(const char* filePath, size_t iterationCount)
+{
+	double minTime = INFINITY, totalTime = 0.0;
+	ConfReader confReader = NULL; bool isImage = false;
+
+	for (size_t i = 0; i < iterationCount; i++)
+	{
+		destroyConfReader(confReader);
+		double startTime = getToolTime();
+		if (!loadToolReader(filePath, &confReader, &isImage))
+			return EXIT_FAILURE;
+		double time = getToolTime() - startTime;
+
+		if (time < minTime)
+			minTime = time;
+		totalTime += time;
+	}
+
+	ConfMemoryUsage memoryUsage;
+	getConfReaderMemoryUsage(confReader, &memoryUsage);
+
+	size_t itemCount = getConfReaderItemCount(confReader);
+	printf("%s: %llu items (%s)\n", filePath, (long long unsigned int)itemCount, isImage ? "image" : "text");
+	printf("Load: min %.3f ms, average %.3f ms (%llu iterations)\n", minTime * 1000.0,
+		totalTime * 1000.0 / (double)iterationCount, (long long unsigned int)iterationCount);
+	printf("Memory: items %.1f KiB, data %.1f KiB, hash index %.1f KiB, sections %.1f KiB",
+		(double)memoryUsage.items / 1024.0, (double)memoryUsage.data / 1024.0,
+		(double)memoryUsage.hashIndex / 1024.0, (double)memoryUsage.sections / 1024.0);
+	if (isImage)
+		printf(" (mapped image %.1f KiB)", (double)memoryUsage.mapped / 1024.0);
+	printf("\n");
+
+	if (itemCount > 0)
+	{
+		// Note: image may already contain a stored hash index, binary search is not used then.
+		size_t lookupCount = (CONFC_LOOKUP_COUNT / itemCount + 1) * itemCount;
+		size_t searchChecksum = lookupCount, hashChecksum;
+		if (memoryUsage.hashIndex > 0)
+		{
+			double hashTime = measureToolLookups(confReader, &hashChecksum);
+			printf("Lookup: hash index %.1f ns (stored in image)\n", hashTime);
+		}
+		else
+		{
+			double searchTime = measureToolLookups(confReader, &searchChecksum);
+			ConfResult confResult = buildConfReaderHashIndex(confReader, 0);
+			if (confResult != SUCCESS_CONF_RESULT)
+			{
+				destroyConfReader(confReader);
+				fprintf(stderr, "%s: %s.\n", filePath, confResultToString(confResult));
+				return EXIT_FAILURE;
+			}
+
+			double hashTime = measureToolLookups(confReader, &hashChecksum);
+			getConfReaderMemoryUsage(confReader, &memoryUsage);
+			printf("Lookup: binary search %.1f ns, hash index %.1f ns (+%.1f KiB)\n", searchTime,
+				hashTime, (double)memoryUsage.hashIndex / 1024.0);
+		}
+
+		if (searchChecksum != lookupCount || hashChecksum != lookupCount)
+		{
+			destroyConfReader(confReader);
+			fprintf(stderr, "%s: incorrect lookup results.\n", filePath);
+			return EXIT_FAILURE;
+		}
+	}
+
+	destroyConfReader(confReader);
+	return EXIT_SUCCESS;
+}
+
+//**********************************************************************************************************************
+static void printToolUsage()
+{
+	fprintf(stderr,
+		"Usage: confc <command> [arguments]\n"
+		"\n"
+		"Commands:\n"
+		"  validate [--types] <file>     Check syntax, repeating keys and item types\n"
+		"  dump <file>                   Print sorted items of the text or image config\n"
+		"  compile <file> <image>        Convert text config to the binary image\n"
+		"  decompile <image> <file>      Convert binary image back to the text config\n"
+		"  bench <file> [iterations]     Measure load time, memory and lookup latency\n");
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		printToolUsage();
+		return EXIT_FAILURE;
+	}
+
+	const char* command = argv[1];
+	if (strcmp(command, "validate") == 0)
+	{
+		if (argc == 4 && strcmp(argv[2], "--types") == 0)
+			return validateConfFile(argv[3], true);
+		if (argc == 3)
+			return validateConfFile(argv[2], false);
+	}
+	else if (strcmp(command, "dump") == 0)
+	{
+		if (argc == 3)
+			return dumpConfFile(argv[2]);
+	}
+	else if (strcmp(command, "compile") == 0)
+	{
+		if (argc == 4)
+			return compileConfFile(argv[2], argv[3]);
+	}
+	else if (strcmp(command, "decompile") == 0)
+	{
+		if (argc == 4)
+			return decompileConfImage(argv[2], argv[3]);
+	}
+	else if (strcmp(command, "bench") == 0)
+	{
+		size_t iterationCount = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : 10;
+		if (argc <= 4 && iterationCount > 0)
+			return benchmarkConfFile(argv[2], iterationCount);
+	}
+
+	printToolUsage();
+	return EXIT_FAILURE;
+}
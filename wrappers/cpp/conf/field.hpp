@@ -0,0 +1,69 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf struct field descriptions.
+ *
+ * @details
+ * Used to describe a struct once, and then load it with the Reader::load() and save with the Writer::save().
+ *
+ * @code
+ * struct Settings
+ * {
+ *     int32_t width = 1280;
+ *     string title = "Game";
+ *
+ *     static constexpr auto confFields = make_tuple(
+ *         conf::field("width", &Settings::width),
+ *         conf::field("title", &Settings::title));
+ * };
+ * @endcode
+ */
+
+#pragma once
+#include <tuple>
+#include <cstdint>
+
+namespace conf
+{
+
+/**
+ * @brief Conf struct field description.
+ *
+ * @tparam S target struct type
+ * @tparam T struct field type
+ */
+template<typename S, typename T>
+struct Field
+{
+	using Type = T;
+	const char* key;
+	size_t keyLength;
+	T S::* member;
+};
+
+/**
+ * @brief Creates a new Conf struct field description.
+ *
+ * @param[in] key target item key string literal
+ * @param member pointer to the struct member
+ */
+template<typename S, typename T, size_t N>
+constexpr Field<S, T> field(const char (&key)[N], T S::* member) noexcept
+{
+	return { key, N - 1, member };
+}
+
+} // namespace conf
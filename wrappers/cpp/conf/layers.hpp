@@ -0,0 +1,196 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf layered overlay lookups.
+ * @details See the @ref layers.h
+ */
+
+#pragma once
+#include "conf/reader.hpp"
+#include <string>
+
+extern "C"
+{
+#include "conf/layers.h"
+}
+
+namespace conf
+{
+
+/**
+ * @brief Conf layered overlay lookups instance handle.
+ * @details See the @ref layers.h
+ */
+class Layers final
+{
+private:
+	ConfLayers instance = nullptr;
+public:
+	/**
+	 * @brief Creates a new empty Conf layers instance.
+	 * @details See the @ref createConfLayers().
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	Layers()
+	{
+		auto result = createConfLayers(&instance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+	}
+	/**
+	 * @brief Destroys Conf layers instance.
+	 * @details See the @ref destroyConfLayers().
+	 */
+	~Layers() { destroyConfLayers(instance); }
+
+	Layers(const Layers&) = delete;
+	Layers& operator=(const Layers&) = delete;
+	Layers(Layers&& other) noexcept : instance(other.instance) { other.instance = nullptr; }
+	Layers& operator=(Layers&& other) noexcept { swap(instance, other.instance); return *this; }
+
+	/**
+	 * @brief Adds a new top priority Conf reader layer.
+	 * @details See the @ref addConfLayersReader().
+	 * @param reader conf reader (moved to the layers on success)
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	void add(Reader&& reader)
+	{
+		if (!reader.isOwner)
+			throw Error("Layers require an owning reader");
+		auto result = addConfLayersReader(instance, reader.instance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+		reader.instance = nullptr;
+	}
+	/**
+	 * @brief Adds a new top priority layer from the environment variables.
+	 * @details See the @ref addConfLayersEnvironment().
+	 *
+	 * @param prefix target variable name prefix
+	 * @param[in] environment null terminated "NAME=value" string array, or null to read the process environment
+	 *
+	 * @throw Error with a @ref ConfResult string and variable number on failure.
+	 */
+	void addEnvironment(const string& prefix, const char* const* environment = nullptr)
+	{
+		size_t errorLine = 0;
+		auto result = addConfLayersEnvironment(instance, environment, prefix.c_str(), &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+	}
+	/**
+	 * @brief Adds a new top priority layer from the command line arguments.
+	 * @details See the @ref addConfLayersArguments().
+	 *
+	 * @param argumentCount command line argument count (argc)
+	 * @param[in] arguments command line argument string array (argv)
+	 *
+	 * @throw Error with a @ref ConfResult string and argument number on failure.
+	 */
+	void addArguments(int argumentCount, const char* const* arguments)
+	{
+		size_t errorLine = 0;
+		auto result = addConfLayersArguments(instance, argumentCount, arguments, &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+	}
+
+	/*******************************************************************************************************************
+	 * @brief Returns the Conf layers count.
+	 * @details See the @ref getConfLayersCount().
+	 */
+	size_t getCount() const noexcept { return getConfLayersCount(instance); }
+	/**
+	 * @brief Returns the merged Conf layers item count.
+	 * @details See the @ref getConfLayersItemCount().
+	 */
+	size_t getItemCount() const noexcept { return getConfLayersItemCount(instance); }
+
+	/**
+	 * @brief Returns the value type by key.
+	 * @details See the @ref getConfLayersType().
+	 *
+	 * @param key target item key string
+	 * @param[out] type reference to the value type
+	 *
+	 * @return True on success, false if item is not found.
+	 */
+	bool getType(string_view key, ConfDataType& type) const noexcept
+	{
+		ConfReader reader; size_t handle;
+		if (!resolveConfLayersKey(instance, key.data(), key.size(), &reader, &handle))
+			return false;
+		type = getConfReaderTypeAt(reader, handle);
+		return true;
+	}
+
+	/**
+	 * @brief Returns the top priority layer value by key.
+	 * @details See the @ref Reader::getAt().
+	 *
+	 * @tparam T target value type
+	 * @param key target item key string
+	 * @param[out] value reference to the value
+	 *
+	 * @return True on success, false if item is not found, has a different type or value is out of range.
+	 */
+	template<typename T>
+	bool get(string_view key, T& value) const
+	{
+		ConfReader reader; size_t handle;
+		if (!resolveConfLayersKey(instance, key.data(), key.size(), &reader, &handle))
+			return false;
+		return Reader(reader, false).getAt(handle, value);
+	}
+
+	/**
+	 * @brief Returns the top priority layer value by key if it exists.
+	 * @details See the @ref Reader::getAt().
+	 *
+	 * @tparam T target value type
+	 * @param key target item key string
+	 *
+	 * @return Item value, or empty if item is not found, has a different type or value is out of range.
+	 */
+	template<typename T>
+	optional<T> get(string_view key) const
+	{
+		T value;
+		if (get(key, value))
+			return value;
+		return nullopt;
+	}
+
+	/**
+	 * @brief Returns the top priority layer value by key or the default one.
+	 * @details See the @ref Reader::getAt().
+	 *
+	 * @tparam T target value type
+	 * @param key target item key string
+	 * @param defaultValue value returned if item is not found, has a different type or value is out of range
+	 */
+	template<typename T>
+	T getOr(string_view key, T defaultValue) const
+	{
+		T value;
+		if (get(key, value))
+			return value;
+		return defaultValue;
+	}
+};
+
+} // namespace conf
@@ -20,8 +20,13 @@
 
 #pragma once
 #include "conf/error.hpp"
+#include "conf/field.hpp"
+#include <cmath>
+#include <limits>
+#include <optional>
 #include <filesystem>
 #include <string_view>
+#include <type_traits>
 
 extern "C"
 {
@@ -31,6 +36,86 @@ extern "C"
 namespace conf
 {
 
+/**
+ * @brief Returns the Conf item key hash at compile time. (SipHash-1-3)
+ * @details Produces the same value as the @ref hashConfKey().
+ *
+ * @param key target item key string
+ * @param seed hash function seed
+ */
+constexpr uint64_t hashKey(string_view key, uint64_t seed) noexcept
+{
+	auto rotate = [](uint64_t x, int b) constexpr { return (x << b) | (x >> (64 - b)); };
+	uint64_t v0 = seed ^ 0x736f6d6570736575ull, v1 = ~seed ^ 0x646f72616e646f6dull;
+	uint64_t v2 = seed ^ 0x6c7967656e657261ull, v3 = ~seed ^ 0x7465646279746573ull;
+
+	auto round = [&]() constexpr
+	{
+		v0 += v1; v1 = rotate(v1, 13); v1 ^= v0; v0 = rotate(v0, 32);
+		v2 += v3; v3 = rotate(v3, 16); v3 ^= v2;
+		v0 += v3; v3 = rotate(v3, 21); v3 ^= v0;
+		v2 += v1; v1 = rotate(v1, 17); v1 ^= v2; v2 = rotate(v2, 32);
+	};
+
+	auto size = key.size(), blockEnd = size - size % 8;
+	for (size_t i = 0; i < blockEnd; i += 8)
+	{
+		uint64_t block = 0;
+		for (size_t j = 0; j < 8; j++)
+			block |= (uint64_t)(uint8_t)key[i + j] << (j * 8);
+		v3 ^= block; round(); v0 ^= block;
+	}
+
+	uint64_t block = (uint64_t)size << 56;
+	for (size_t i = blockEnd; i < size; i++)
+		block |= (uint64_t)(uint8_t)key[i] << ((i - blockEnd) * 8);
+	v3 ^= block; round(); v0 ^= block;
+
+	v2 ^= 0xff; round(); round(); round();
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+/**
+ * @brief Conf item key with a precomputed hash.
+ * @details Declare it as constexpr to hash the key string at compile time.
+ */
+class Key final
+{
+	string_view value;
+	uint64_t hash;
+public:
+	/**
+	 * @brief Default key hash function seed. (@ref Reader::buildHashIndex())
+	 */
+	static constexpr uint64_t defaultSeed = 0;
+
+	/**
+	 * @brief Creates a new Conf item key.
+	 * @param key target item key string
+	 */
+	constexpr explicit Key(string_view key) noexcept : value(key), hash(hashKey(key, defaultSeed)) { }
+
+	/**
+	 * @brief Returns key string.
+	 */
+	constexpr string_view getValue() const noexcept { return value; }
+	/**
+	 * @brief Returns key hash computed with the default seed.
+	 */
+	constexpr uint64_t getHash() const noexcept { return hash; }
+};
+
+/**
+ * @brief Conf user-defined literals.
+ */
+namespace literals
+{
+	/**
+	 * @brief Creates a new Conf item key with a precomputed hash. ("render.width"_ck)
+	 */
+	constexpr Key operator""_ck(const char* key, size_t length) noexcept { return Key(string_view(key, length)); }
+} // namespace literals
+
 /**
  * @brief Conf reader instance handle.
  * @details See the @ref reader.h
@@ -39,6 +124,81 @@ class Reader final
 {
 private:
 	ConfReader instance = nullptr;
+	bool isOwner = true;
+
+	explicit Reader(ConfReader view, bool isOwner = true) noexcept : instance(view), isOwner(isOwner) { }
+	friend class Parser;
+	friend class Watcher;
+	friend class Store;
+	friend class Diff;
+	friend class Layers;
+
+	struct RawValue
+	{
+		union
+		{
+			int64_t integer;
+			double floating;
+			bool boolean;
+			const char* string;
+		};
+		uint64_t length = 0;
+	};
+
+	template<typename T>
+	static constexpr ConfDataType getDataType() noexcept
+	{
+		if constexpr (is_same_v<T, bool>)
+			return BOOLEAN_CONF_DATA_TYPE;
+		else if constexpr (is_integral_v<T>)
+			return INTEGER_CONF_DATA_TYPE;
+		else if constexpr (is_floating_point_v<T>)
+			return FLOATING_CONF_DATA_TYPE;
+		else if constexpr (is_same_v<T, string_view> || is_same_v<T, string>)
+			return STRING_CONF_DATA_TYPE;
+		else
+			static_assert(!is_same_v<T, T>, "Unsupported Conf value type");
+	}
+
+	template<typename T>
+	static bool castValue(const RawValue& raw, T& value)
+	{
+		if constexpr (is_same_v<T, bool>)
+		{
+			value = raw.boolean;
+		}
+		else if constexpr (is_integral_v<T>)
+		{
+			if constexpr (is_signed_v<T>)
+			{
+				if (raw.integer < (int64_t)numeric_limits<T>::min() || raw.integer > (int64_t)numeric_limits<T>::max())
+					return false;
+			}
+			else
+			{
+				if (raw.integer < 0 || (uint64_t)raw.integer > (uint64_t)numeric_limits<T>::max())
+					return false;
+			}
+			value = (T)raw.integer;
+		}
+		else if constexpr (is_floating_point_v<T>)
+		{
+			if constexpr (sizeof(T) < sizeof(double))
+			{
+				if (isfinite(raw.floating) && (raw.floating > (double)numeric_limits<T>::max() ||
+					raw.floating < (double)numeric_limits<T>::lowest()))
+				{
+					return false;
+				}
+			}
+			value = (T)raw.floating;
+		}
+		else
+		{
+			value = T(raw.string, (size_t)raw.length);
+		}
+		return true;
+	}
 public:
 	/**
 	 * @brief Creates a new Conf file reader instance.
@@ -70,245 +230,585 @@ public:
 	}
 
 	/**
-	 * @brief Destroys Conf reader instance.
-	 * @details See the @ref destroyConfReader().
+	 * @brief Creates a new Conf file reader instance.
+	 * @details See the @ref createFileConfReader().
+	 * @param[in] filePath target Conf file path string
+	 * @throw Error with a @ref ConfResult string and line number on failure.
 	 */
-	~Reader() { destroyConfReader(instance); }
+	Reader(const string& filePath) : Reader(filesystem::path(filePath)) { }
 
-	/*******************************************************************************************************************
-	 * @brief Returns the type of value by key.
-	 * @details See the @ref getConfReaderType().
+	/**
+	 * @brief Creates a new Conf data reader instance.
+	 * @details See the @ref createDataConfReaderN() and @ref createBorrowedDataConfReader().
+	 * @warning Borrowed data buffer should outlive the reader!
 	 * 
-	 * @param[in] key target item key string
-	 * @param[out] type reference to the value type
+	 * @param data target Conf data buffer
+	 * @param borrowData use data buffer without copying keys and string values (if there are no sections)
+	 * @note With sections borrowed data is copied, use the @ref isBorrowed() to check it.
 	 * 
-	 * @return True on success, false if item is not found.
+	 * @throw Error with a @ref ConfResult string and line number on failure.
 	 */
-	bool getType(const string& key, ConfDataType& type) const noexcept
+	Reader(string_view data, bool borrowData = false)
 	{
-		return getConfReaderType(instance, key.c_str(), &type);
+		size_t errorLine = 0;
+		auto result = borrowData ?
+			createBorrowedDataConfReader(data.data(), data.size(), &instance, &errorLine) :
+			createDataConfReaderN(data.data(), data.size(), &instance, &errorLine);
+		if (result != SUCCESS_CONF_RESULT && result != OWNED_DATA_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
 	}
 
 	/**
-	 * @brief Returns the integer value by key. (int64)
-	 * @details See the @ref getConfReaderInt().
+	 * @brief Creates a new Conf reader instance from the compiled binary image file.
+	 * @details See the @ref createImageConfReader().
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
-	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param[in] filePath target Conf image file path
+	 * @param verifyData also check the whole image checksum
+	 *
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	static Reader fromImage(const filesystem::path& filePath, bool verifyData = true)
+	{
+		ConfReader instance = nullptr;
+		auto string = filePath.generic_string();
+		auto result = createImageConfReader(string.c_str(), verifyData, &instance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+		return Reader(instance);
+	}
+
+	/**
+	 * @brief Destroys Conf reader instance.
+	 * @details See the @ref destroyConfReader().
+	 */
+	~Reader() { if (isOwner) destroyConfReader(instance); }
+
+	Reader(const Reader&) = delete;
+	Reader& operator=(const Reader&) = delete;
+	Reader(Reader&& other) noexcept : instance(other.instance), isOwner(other.isOwner) { other.instance = nullptr; }
+	Reader& operator=(Reader&& other) noexcept
+	{
+		swap(instance, other.instance); swap(isOwner, other.isOwner);
+		return *this;
+	}
+
+	/**
+	 * @brief Builds a hash table index for the Conf reader key lookups.
+	 * @details See the @ref buildConfReaderHashIndex().
+	 * @param seed key hash function seed
+	 * @throw Error with a @ref ConfResult string on failure.
 	 */
-	bool get(const string& key, int64_t& value) const noexcept
+	void buildHashIndex(uint64_t seed = Key::defaultSeed)
 	{
-		return getConfReaderInt(instance, key.c_str(), &value);
+		auto result = buildConfReaderHashIndex(instance, seed);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+	}
+
+	/**
+	 * @brief Writes Conf reader items to the compiled binary image file.
+	 * @details See the @ref writeConfReaderImage().
+	 * @param[in] filePath target Conf image file path
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	void writeImage(const filesystem::path& filePath) const
+	{
+		auto string = filePath.generic_string();
+		auto result = writeConfReaderImage(instance, string.c_str());
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
 	}
 
 	/**
-	 * @brief Returns the integer value by key. (int32)
-	 * @details See the @ref getConfReaderInt().
+	 * @brief Resolves item key to a handle for the fast value access.
+	 * @details See the @ref resolveConfReaderKey().
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
-	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param key target item key string
+	 * @param[out] handle reference to the item handle
+	 *
+	 * @return True on success, false if item is not found.
 	 */
-	bool get(const string& key, int32_t& value) const noexcept
+	bool resolve(string_view key, size_t& handle) const noexcept
 	{
-		int64_t v;
-		if (get(key, v))
-		{
-			value = (int32_t)v;
-			return true;
-		}
-		return false;
+		return resolveConfReaderKey(instance, key.data(), key.size(), &handle);
+	}
+	/**
+	 * @brief Resolves precomputed item key to a handle for the fast value access.
+	 * @details See the @ref resolveConfReaderHashedKey().
+	 *
+	 * @param key target item key
+	 * @param[out] handle reference to the item handle
+	 *
+	 * @return True on success, false if item is not found.
+	 */
+	bool resolve(const Key& key, size_t& handle) const noexcept
+	{
+		auto value = key.getValue();
+		return resolveConfReaderHashedKey(instance, value.data(),
+			value.size(), key.getHash(), Key::defaultSeed, &handle);
 	}
 
 	/**
-	 * @brief Returns the integer value by key. (uint32)
-	 * @details See the @ref getConfReaderInt().
+	 * @brief Returns multiple values by keys in one pass.
+	 * @details See the @ref getConfReaderBatch().
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
-	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param[in] lookups array of the lookup requests
+	 * @param lookupCount number of the lookup requests
+	 * @param[out] statusBits array of the (lookupCount + 63) / 64 status words or nullptr
+	 *
+	 * @return The number of found values.
 	 */
-	bool get(const string& key, uint32_t& value) const noexcept
+	size_t getBatch(const ConfLookup* lookups, size_t lookupCount, uint64_t* statusBits = nullptr) const noexcept
 	{
-		int64_t v;
-		if (get(key, v))
-		{
-			value = (uint32_t)v;
-			return true;
-		}
-		return false;
+		return getConfReaderBatch(instance, lookups, lookupCount, statusBits);
+	}
+
+	/**
+	 * @brief Returns true if reader keys and string values point to the borrowed data buffer.
+	 * @details See the @ref isConfReaderBorrowed().
+	 */
+	bool isBorrowed() const noexcept { return isConfReaderBorrowed(instance); }
+
+	/**
+	 * @brief Returns the Conf reader memory usage.
+	 * @details See the @ref getConfReaderMemoryUsage().
+	 */
+	ConfMemoryUsage getMemoryUsage() const noexcept
+	{
+		ConfMemoryUsage memoryUsage;
+		getConfReaderMemoryUsage(instance, &memoryUsage);
+		return memoryUsage;
 	}
 
 	/*******************************************************************************************************************
-	 * @brief Returns the integer value by key. (int16)
-	 * @details See the @ref getConfReaderInt().
+	 * @brief Returns the Conf reader item count.
+	 * @details See the @ref getConfReaderItemCount().
+	 */
+	size_t getItemCount() const noexcept { return getConfReaderItemCount(instance); }
+
+	/**
+	 * @brief Returns the Conf reader item key and type by index.
+	 * @details See the @ref getConfReaderItem(). Use the @ref getAt() to get the value.
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
-	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param index target item index
+	 * @param[out] key reference to the item key string
+	 * @param[out] type reference to the value type
+	 *
+	 * @return True on success, false if index is out of range.
 	 */
-	bool get(const string& key, int16_t& value) const noexcept
+	bool getItem(size_t index, string_view& key, ConfDataType& type) const noexcept
 	{
-		int64_t v;
-		if (get(key, v))
-		{
-			value = (int16_t)v;
-			return true;
-		}
-		return false;
+		const char* keyData; size_t keyLength;
+		if (!getConfReaderItem(instance, index, &keyData, &keyLength, &type))
+			return false;
+		key = string_view(keyData, keyLength);
+		return true;
 	}
 
 	/**
-	 * @brief Returns the integer value by key. (uint16)
-	 * @details See the @ref getConfReaderInt().
+	 * @brief Returns the config section view.
+	 * @details See the @ref getConfReaderSection().
+	 * @note View is valid until this reader is destroyed.
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
-	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param name target section name string
+	 * @return Section reader view, or empty if section is not found.
 	 */
-	bool get(const string& key, uint16_t& value) const noexcept
+	optional<Reader> getSection(string_view name) const noexcept
 	{
-		int64_t v;
-		if (get(key, v))
-		{
-			value = (uint16_t)v;
-			return true;
-		}
-		return false;
+		ConfReader section;
+		if (!getConfReaderSectionN(instance, name.data(), name.size(), &section))
+			return nullopt;
+		return Reader(section);
 	}
-	
+
 	/**
-	 * @brief Returns the integer value by key. (int8)
-	 * @details See the @ref getConfReaderInt().
+	 * @brief Finds the range of items whose keys start with the prefix.
+	 * @details See the @ref findConfReaderPrefix().
+	 *
+	 * @param prefix target key prefix string
+	 * @param[out] first reference to the first matching item index
+	 * @param[out] count reference to the matching item count
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
+	 * @return True if at least one item is found, otherwise false.
+	 */
+	bool findPrefix(string_view prefix, size_t& first, size_t& count) const noexcept
+	{
+		return findConfReaderPrefix(instance, prefix.data(), prefix.size(), &first, &count);
+	}
+
+	/**
+	 * @brief Returns the type of value by item handle.
+	 * @details See the @ref getConfReaderTypeAt().
+	 * @param handle target item handle
+	 * @return The item value type, or CONF_DATA_TYPE_COUNT if handle is out of range.
+	 */
+	ConfDataType getTypeAt(size_t handle) const noexcept
+	{
+		return getConfReaderTypeAt(instance, handle);
+	}
+
+	/**
+	 * @brief Returns the value by item handle.
+	 * @details Supported types: integers, float, double, bool, string_view and string.
+	 * 
+	 * Integer values that don't fit into the target type are treated as a type mismatch.
+	 * Integers are also converted to the floating types, like in the @ref getConfReaderFloat().
+	 * 
+	 * @tparam T target value type
+	 * @param handle target item handle
+	 * @param[out] value reference to the value
 	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @return True on success, false if item has a different type, value or handle is out of range.
 	 */
-	bool get(const string& key, int8_t& value) const noexcept
+	template<typename T>
+	bool getAt(size_t handle, T& value) const
 	{
-		int64_t v;
-		if (get(key, v))
-		{
-			value = (int8_t)v;
-			return true;
-		}
-		return false;
+		constexpr auto type = getDataType<T>();
+		RawValue raw;
+		bool result;
+
+		if constexpr (type == BOOLEAN_CONF_DATA_TYPE)
+			result = getConfReaderBoolAt(instance, handle, &raw.boolean);
+		else if constexpr (type == INTEGER_CONF_DATA_TYPE)
+			result = getConfReaderIntAt(instance, handle, &raw.integer);
+		else if constexpr (type == FLOATING_CONF_DATA_TYPE)
+			result = getConfReaderFloatAt(instance, handle, &raw.floating);
+		else
+			result = getConfReaderStringAt(instance, handle, &raw.string, &raw.length);
+		return result && castValue(raw, value);
 	}
 
 	/**
-	 * @brief Returns the integer value by key. (uint8)
-	 * @details See the @ref getConfReaderInt().
-	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the integer value
+	 * @brief Loads struct fields from the config in one batch lookup.
+	 * @details Fields that are missing or have a different type keep their current values.
 	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param[out] value reference to the target struct
+	 * @param[in] fields tuple of the struct field descriptions (@ref field())
+	 * 
+	 * @return The number of loaded fields.
 	 */
-	bool get(const string& key, uint8_t& value) const noexcept
+	template<typename S, typename... F>
+	size_t load(S& value, const tuple<F...>& fields) const
 	{
-		int64_t v;
-		if (get(key, v))
+		constexpr auto count = sizeof...(F);
+		static_assert(count > 0, "Struct should have at least one field");
+
+		ConfLookup lookups[count];
+		RawValue raws[count];
+		uint64_t statusBits[(count + 63) / 64];
+
+		size_t index = 0;
+		apply([&](const auto&... field)
 		{
-			value = (uint8_t)v;
-			return true;
-		}
-		return false;
+			((lookups[index] = ConfLookup
+			{
+				field.key, field.keyLength,
+				getDataType<typename remove_reference_t<decltype(field)>::Type>(),
+				&raws[index].integer, &raws[index].length
+			}, index++), ...);
+		}, fields);
+
+		getConfReaderBatch(instance, lookups, count, statusBits);
+
+		size_t loadedCount = 0; index = 0;
+		apply([&](const auto&... field)
+		{
+			((loadedCount += ((statusBits[index / 64] >> (index % 64)) & 1u) &&
+				castValue(raws[index], value.*field.member), index++), ...);
+		}, fields);
+		return loadedCount;
 	}
+	/**
+	 * @brief Loads struct fields from the config in one batch lookup.
+	 * @details Uses the static S::confFields tuple, see the @ref load(S&, const tuple<F...>&).
+	 * @param[out] value reference to the target struct
+	 * @return The number of loaded fields.
+	 */
+	template<typename S>
+	size_t load(S& value) const { return load(value, S::confFields); }
 
 	/*******************************************************************************************************************
-	 * @brief Returns the floating value by key. (double)
-	 * @details See the @ref getConfReaderFloat().
-	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the floating value
+	 * @brief Returns the type of value by key.
+	 * @details See the @ref getConfReaderTypeN().
 	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @param key target item key string
+	 * @param[out] type reference to the value type
+	 * 
+	 * @return True on success, false if item is not found.
 	 */
-	bool get(const string& key, double& value) const noexcept
+	bool getType(string_view key, ConfDataType& type) const noexcept
 	{
-		return getConfReaderFloat(instance, key.c_str(), &value);
+		return getConfReaderTypeN(instance, key.data(), key.size(), &type);
 	}
-
 	/**
-	 * @brief Returns the floating value by key. (float)
-	 * @details See the @ref getConfReaderFloat().
-	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the floating value
+	 * @brief Returns the type of value by precomputed key.
+	 * @details See the @ref resolve(const Key&, size_t&).
+	 * 
+	 * @param key target item key
+	 * @param[out] type reference to the value type
 	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @return True on success, false if item is not found.
 	 */
-	bool get(const string& key, float& value) const noexcept
+	bool getType(const Key& key, ConfDataType& type) const noexcept
 	{
-		double v;
-		if (get(key, v))
-		{
-			value = (float)v;
-			return true;
-		}
-		return false;
+		size_t handle;
+		if (!resolve(key, handle))
+			return false;
+		type = getConfReaderTypeAt(instance, handle);
+		return true;
 	}
 
 	/**
-	 * @brief Returns the boolean value by key.
-	 * @details See the @ref getConfReaderBool().
+	 * @brief Returns the value by key.
+	 * @details See the @ref getAt().
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the boolean value
+	 * @tparam T target value type
+	 * @param key target item key string or precomputed @ref Key
+	 * @param[out] value reference to the value
 	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @return True on success, false if item is not found, has a different type or value is out of range.
 	 */
-	bool get(const string& key, bool& value) const noexcept
+	template<typename T, typename K>
+	bool get(const K& key, T& value) const
 	{
-		return getConfReaderBool(instance, key.c_str(), &value);
+		size_t handle;
+		return resolve(key, handle) && getAt(handle, value);
 	}
 
 	/**
-	 * @brief Returns the string value by key.
-	 * @details See the @ref getConfReaderString().
+	 * @brief Returns the value by key if it exists.
+	 * @details See the @ref getAt().
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the string value
+	 * @tparam T target value type
+	 * @param key target item key string or precomputed @ref Key
 	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @return Item value, or empty if item is not found, has a different type or value is out of range.
 	 */
-	bool get(const string& key, string_view& value) const noexcept
+	template<typename T, typename K>
+	optional<T> get(const K& key) const
 	{
-		uint64_t length; const char* _string;
-		if (getConfReaderString(instance, key.data(), &_string, &length))
-		{
-			value = string_view(_string, (size_t)length);
-			return true;
-		}
-		return false;
+		T value;
+		if (get(key, value))
+			return value;
+		return nullopt;
 	}
+
 	/**
-	 * @brief Returns the string value by key.
-	 * @details See the @ref getConfReaderString().
+	 * @brief Returns the value by key or the default one.
+	 * @details See the @ref getAt().
 	 *
-	 * @param[in] key target item key string
-	 * @param[out] value reference to the string value
-	 * 
-	 * @return True on success, false if item is not found or has a different type.
+	 * @tparam T target value type
+	 * @param key target item key string or precomputed @ref Key
+	 * @param defaultValue value returned if item is not found, has a different type or value is out of range
 	 */
-	bool get(const string& key, string& value) const noexcept
+	template<typename T, typename K>
+	T getOr(const K& key, T defaultValue) const
 	{
-		uint64_t length; const char* _string;
-		if (getConfReaderString(instance, key.data(), &_string, &length))
+		T value;
+		if (get(key, value))
+			return value;
+		return defaultValue;
+	}
+};
+
+/***********************************************************************************************************************
+ * @brief Conf reader item difference.
+ * @details See the @ref ConfDiff.
+ */
+struct DiffItem
+{
+	string_view key;
+	ConfChange change;
+	size_t oldIndex;
+	size_t newIndex;
+};
+
+/**
+ * @brief Range over the differences between two Conf readers. (O(n + m), no allocations)
+ * @details See the @ref nextConfReaderDiff().
+ * @note Both readers should stay alive while the range is used.
+ *
+ * @code
+ * for (const auto& item : conf::Diff(oldReader, newReader))
+ *     printf("%.*s\n", (int)item.key.size(), item.key.data());
+ * @endcode
+ */
+class Diff final
+{
+private:
+	ConfReader oldReader = nullptr;
+	ConfReader newReader = nullptr;
+public:
+	class Iterator final
+	{
+	private:
+		ConfReader oldReader = nullptr;
+		ConfReader newReader = nullptr;
+		ConfDiff diff = { 0, 0, CONF_CHANGE_COUNT };
+		DiffItem item = {};
+
+		void next() noexcept
+		{
+			if (!nextConfReaderDiff(oldReader, newReader, &diff))
+				return;
+
+			const char* key; size_t keyLength; ConfDataType type;
+			if (diff.change == REMOVED_CONF_CHANGE)
+				getConfReaderItem(oldReader, diff.oldIndex, &key, &keyLength, &type);
+			else
+				getConfReaderItem(newReader, diff.newIndex, &key, &keyLength, &type);
+			item = { string_view(key, keyLength), diff.change, diff.oldIndex, diff.newIndex };
+		}
+	public:
+		Iterator() noexcept = default;
+		Iterator(ConfReader oldReader, ConfReader newReader) noexcept :
+			oldReader(oldReader), newReader(newReader) { next(); }
+
+		const DiffItem& operator*() const noexcept { return item; }
+		const DiffItem* operator->() const noexcept { return &item; }
+		Iterator& operator++() noexcept { next(); return *this; }
+
+		bool operator==(const Iterator& other) const noexcept
 		{
-			value = string(_string, (size_t)length);
-			return true;
+			auto isEnd = diff.change == CONF_CHANGE_COUNT, isOtherEnd = other.diff.change == CONF_CHANGE_COUNT;
+			if (isEnd || isOtherEnd)
+				return isEnd == isOtherEnd;
+			return diff.oldIndex == other.diff.oldIndex && diff.newIndex == other.diff.newIndex;
 		}
-		return false;
+		bool operator!=(const Iterator& other) const noexcept { return !(*this == other); }
+	};
+
+	/**
+	 * @brief Creates a new difference range between two Conf readers.
+	 * @param[in] oldReader previous conf reader or section view
+	 * @param[in] newReader current conf reader or section view
+	 */
+	Diff(const Reader& oldReader, const Reader& newReader) noexcept :
+		oldReader(oldReader.instance), newReader(newReader.instance) { }
+
+	Iterator begin() const noexcept { return Iterator(oldReader, newReader); }
+	Iterator end() const noexcept { return Iterator(); }
+
+	/**
+	 * @brief Returns the difference count between two readers.
+	 * @details See the @ref nextConfReaderDiff().
+	 */
+	size_t count() const noexcept
+	{
+		ConfDiff diff = { 0, 0, CONF_CHANGE_COUNT }; size_t count = 0;
+		while (nextConfReaderDiff(oldReader, newReader, &diff))
+			count++;
+		return count;
+	}
+};
+
+/***********************************************************************************************************************
+ * @brief Conf push-based incremental parser.
+ * @details See the @ref ConfParser.
+ */
+class Parser final
+{
+private:
+	ConfParser instance = nullptr;
+public:
+	/**
+	 * @brief Creates a new Conf parser instance.
+	 * @details See the @ref createConfParser().
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	Parser()
+	{
+		auto result = createConfParser(&instance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+	}
+	/**
+	 * @brief Destroys Conf parser instance.
+	 * @details See the @ref destroyConfParser().
+	 */
+	~Parser() { destroyConfParser(instance); }
+
+	Parser(const Parser&) = delete;
+	Parser& operator=(const Parser&) = delete;
+	Parser(Parser&& other) noexcept : instance(other.instance) { other.instance = nullptr; }
+	Parser& operator=(Parser&& other) noexcept { swap(instance, other.instance); return *this; }
+
+	/**
+	 * @brief Parses the next Conf data chunk.
+	 * @details See the @ref feedConfParser().
+	 * @param data target Conf data chunk
+	 * @throw Error with a @ref ConfResult string and line number on failure.
+	 */
+	void feed(string_view data)
+	{
+		size_t errorLine = 0;
+		auto result = feedConfParser(instance, data.data(), data.size(), &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+	}
+	/**
+	 * @brief Parses the last unfinished line and returns a new Conf reader.
+	 * @details See the @ref finishConfParser(). Parser can be reused after this call.
+	 * @throw Error with a @ref ConfResult string and line number on failure.
+	 */
+	Reader finish()
+	{
+		ConfReader reader = nullptr; size_t errorLine = 0;
+		auto result = finishConfParser(instance, &reader, &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+		return Reader(reader);
 	}
 };
 
-} // namespace conf
\ No newline at end of file
+/**
+ * @brief Parses Conf data and calls the function for each item, without creating a reader.
+ * @details See the @ref parseConfData().
+ * 
+ * @param data target Conf data buffer
+ * @param onItem function (string_view key, ConfDataType type, const ConfItemValue& value, size_t line)
+ * @param checkRepeats track item keys and fail on duplicates
+ * 
+ * @throw Error with a @ref ConfResult string and line number on failure.
+ */
+template<typename F>
+void parse(string_view data, F&& onItem, bool checkRepeats = false)
+{
+	auto callback = [](const char* key, size_t keyLength, ConfDataType type,
+		const ConfItemValue* value, size_t line, void* context)
+	{
+		(*(remove_reference_t<F>*)context)(string_view(key, keyLength), type, *value, line);
+	};
+
+	size_t errorLine = 0;
+	auto result = parseConfData(data.data(), data.size(), callback, &onItem, checkRepeats, &errorLine);
+	if (result != SUCCESS_CONF_RESULT)
+		throw Error(confResultToString(result), errorLine);
+}
+/**
+ * @brief Parses Conf file and calls the function for each item, without creating a reader.
+ * @details See the @ref parseConfFile().
+ * 
+ * @param filePath target Conf file path
+ * @param onItem function (string_view key, ConfDataType type, const ConfItemValue& value, size_t line)
+ * @param checkRepeats track item keys and fail on duplicates
+ * 
+ * @throw Error with a @ref ConfResult string and line number on failure.
+ */
+template<typename F>
+void parseFile(const filesystem::path& filePath, F&& onItem, bool checkRepeats = false)
+{
+	auto callback = [](const char* key, size_t keyLength, ConfDataType type,
+		const ConfItemValue* value, size_t line, void* context)
+	{
+		(*(remove_reference_t<F>*)context)(string_view(key, keyLength), type, *value, line);
+	};
+
+	auto string = filePath.generic_string();
+	size_t errorLine = 0;
+	auto result = parseConfFile(string.c_str(), callback, &onItem, checkRepeats, &errorLine);
+	if (result != SUCCESS_CONF_RESULT)
+		throw Error(confResultToString(result), errorLine);
+}
+
+} // namespace conf
@@ -0,0 +1,156 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf concurrent reader store.
+ * @details See the @ref store.h
+ */
+
+#pragma once
+#include "conf/reader.hpp"
+
+extern "C"
+{
+#include "conf/store.h"
+}
+
+namespace conf
+{
+
+/**
+ * @brief Conf concurrent reader store instance handle.
+ * @details See the @ref store.h
+ */
+class Store final
+{
+private:
+	ConfStore instance = nullptr;
+
+	Store(ConfStore instance) noexcept : instance(instance) { }
+	friend class Watcher;
+public:
+	/**
+	 * @brief Acquired Conf reader snapshot. (released on destruction)
+	 * @details See the @ref acquireConfStoreSnapshot().
+	 */
+	class Snapshot final
+	{
+	private:
+		ConfStore store;
+		size_t readerIndex;
+		Reader reader;
+
+		Snapshot(ConfStore store, size_t readerIndex) noexcept : store(store), readerIndex(readerIndex),
+			reader(acquireConfStoreSnapshot(store, readerIndex), false) { }
+		friend class Store;
+	public:
+		~Snapshot() { if (store) releaseConfStoreSnapshot(store, readerIndex); }
+
+		Snapshot(const Snapshot&) = delete;
+		Snapshot& operator=(const Snapshot&) = delete;
+		Snapshot(Snapshot&& other) noexcept : store(other.store),
+			readerIndex(other.readerIndex), reader(std::move(other.reader)) { other.store = nullptr; }
+		Snapshot& operator=(Snapshot&&) = delete;
+
+		/**
+		 * @brief Returns the snapshot reader.
+		 */
+		const Reader& operator*() const noexcept { return reader; }
+		/**
+		 * @brief Returns the snapshot reader.
+		 */
+		const Reader* operator->() const noexcept { return &reader; }
+	};
+
+	/**
+	 * @brief Creates a new Conf concurrent reader store instance.
+	 * @details See the @ref createConfStore().
+	 *
+	 * @param reader initial conf reader (moved to the store)
+	 * @param maxReaderCount maximum registered reader thread count
+	 *
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	Store(Reader&& reader, size_t maxReaderCount)
+	{
+		if (!reader.isOwner)
+			throw Error("Store requires an owning reader");
+		auto result = createConfStore(reader.instance, maxReaderCount, &instance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+		reader.instance = nullptr;
+	}
+	/**
+	 * @brief Destroys Conf store instance.
+	 * @details See the @ref destroyConfStore().
+	 */
+	~Store() { destroyConfStore(instance); }
+
+	Store(const Store&) = delete;
+	Store& operator=(const Store&) = delete;
+	Store(Store&& other) noexcept : instance(other.instance) { other.instance = nullptr; }
+	Store& operator=(Store&& other) noexcept { swap(instance, other.instance); return *this; }
+
+	/**
+	 * @brief Registers a new reader thread and returns its index.
+	 * @details See the @ref registerConfStoreReader().
+	 * @throw Error if all reader slots are used.
+	 */
+	size_t registerReader()
+	{
+		size_t readerIndex;
+		if (!registerConfStoreReader(instance, &readerIndex))
+			throw Error("No free Conf store reader slots");
+		return readerIndex;
+	}
+	/**
+	 * @brief Unregisters reader thread.
+	 * @details See the @ref unregisterConfStoreReader().
+	 * @param readerIndex registered reader index
+	 */
+	void unregisterReader(size_t readerIndex) noexcept { unregisterConfStoreReader(instance, readerIndex); }
+
+	/**
+	 * @brief Acquires the current Conf reader snapshot. (wait-free)
+	 * @details See the @ref acquireConfStoreSnapshot().
+	 * @param readerIndex registered reader index
+	 */
+	Snapshot acquire(size_t readerIndex) const noexcept { return Snapshot(instance, readerIndex); }
+
+	/**
+	 * @brief Publishes a new Conf reader snapshot.
+	 * @details See the @ref publishConfStore().
+	 * @param reader new conf reader (moved to the store on success)
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	void publish(Reader&& reader)
+	{
+		if (!reader.isOwner)
+			throw Error("Store requires an owning reader");
+		auto result = publishConfStore(instance, reader.instance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+		reader.instance = nullptr;
+	}
+
+	/**
+	 * @brief Destroys retired Conf reader snapshots that are no longer visible.
+	 * @details See the @ref reclaimConfStore().
+	 * @return The remaining retired snapshot count.
+	 */
+	size_t reclaim() noexcept { return reclaimConfStore(instance); }
+};
+
+} // namespace conf
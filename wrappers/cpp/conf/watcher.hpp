@@ -0,0 +1,163 @@
+// Copyright 2021-2026 Nikita Fediuchin. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/***********************************************************************************************************************
+ * @file
+ * @brief Conf file watcher. (hot reload)
+ * @details See the @ref watcher.h
+ */
+
+#pragma once
+#include "conf/store.hpp"
+#include <memory>
+#include <vector>
+#include <functional>
+
+extern "C"
+{
+#include "conf/watcher.h"
+}
+
+namespace conf
+{
+
+/**
+ * @brief Conf file watcher instance handle.
+ * @details See the @ref watcher.h
+ */
+class Watcher final
+{
+public:
+	/**
+	 * @brief Conf item change function. (key, change, oldReader, newReader)
+	 */
+	using OnChange = function<void(string_view, ConfChange, const Reader&, const Reader&)>;
+private:
+	ConfWatcher instance = nullptr;
+	vector<unique_ptr<OnChange>> callbacks;
+	optional<Store> store; // Note: destroyed after the watcher instance.
+
+	static void onChange(const char* key, size_t keyLength, ConfChange change,
+		ConfReader oldReader, ConfReader newReader, void* context)
+	{
+		const Reader oldWrapper(oldReader, false), newWrapper(newReader, false);
+		(*(OnChange*)context)(string_view(key, keyLength), change, oldWrapper, newWrapper);
+	}
+public:
+	/**
+	 * @brief Creates a new Conf file watcher instance and reads the file.
+	 * @details See the @ref createConfWatcher().
+	 * @param filePath target Conf file path
+	 * @throw Error with a @ref ConfResult string and line number on failure.
+	 */
+	Watcher(const filesystem::path& filePath)
+	{
+		auto string = filePath.generic_string();
+		size_t errorLine = 0;
+		auto result = createConfWatcher(string.c_str(), &instance, &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+	}
+	/**
+	 * @brief Destroys Conf watcher instance.
+	 * @details See the @ref destroyConfWatcher().
+	 */
+	~Watcher() { destroyConfWatcher(instance); }
+
+	Watcher(const Watcher&) = delete;
+	Watcher& operator=(const Watcher&) = delete;
+	Watcher(Watcher&& other) noexcept : instance(other.instance),
+		callbacks(std::move(other.callbacks)), store(std::move(other.store))
+	{
+		other.instance = nullptr;
+	}
+	Watcher& operator=(Watcher&& other) noexcept
+	{
+		swap(instance, other.instance); swap(callbacks, other.callbacks); swap(store, other.store);
+		return *this;
+	}
+
+	/**
+	 * @brief Creates a new Conf store fed by this watcher.
+	 * @details See the @ref createConfWatcherStore(). Store is destroyed after the watcher.
+	 *
+	 * @param maxReaderCount maximum registered reader thread count
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	Store& createStore(size_t maxReaderCount)
+	{
+		ConfStore storeInstance;
+		auto result = createConfWatcherStore(instance, maxReaderCount, &storeInstance);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result));
+		store.emplace(Store(storeInstance));
+		return *store;
+	}
+
+	/**
+	 * @brief Returns the current Conf reader. (non owning)
+	 * @details See the @ref getConfWatcherReader().
+	 * @warning Returned reader is destroyed on the next successful reload! Use the store from other threads.
+	 */
+	Reader getReader() const noexcept { return Reader(getConfWatcherReader(instance), false); }
+
+	/**
+	 * @brief Adds a new Conf item change function.
+	 * @details See the @ref addConfWatcherCallback().
+	 *
+	 * @param prefix target item key prefix ("" for all items)
+	 * @param onChange item change function
+	 *
+	 * @throw Error with a @ref ConfResult string on failure.
+	 */
+	void addCallback(const string& prefix, OnChange onChange)
+	{
+		callbacks.push_back(make_unique<OnChange>(std::move(onChange)));
+		auto result = addConfWatcherCallback(instance, prefix.c_str(), Watcher::onChange, callbacks.back().get());
+		if (result != SUCCESS_CONF_RESULT)
+		{
+			callbacks.pop_back();
+			throw Error(confResultToString(result));
+		}
+	}
+
+	/**
+	 * @brief Reloads Conf file if it was changed since the last update.
+	 * @details See the @ref updateConfWatcher().
+	 * @return True if file was reloaded, otherwise false.
+	 * @throw Error with a @ref ConfResult string and line number on failure.
+	 */
+	bool update()
+	{
+		bool isReloaded = false; size_t errorLine = 0;
+		auto result = updateConfWatcher(instance, &isReloaded, &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+		return isReloaded;
+	}
+	/**
+	 * @brief Reloads Conf file and calls change functions.
+	 * @details See the @ref reloadConfWatcher().
+	 * @throw Error with a @ref ConfResult string and line number on failure.
+	 */
+	void reload()
+	{
+		size_t errorLine = 0;
+		auto result = reloadConfWatcher(instance, &errorLine);
+		if (result != SUCCESS_CONF_RESULT)
+			throw Error(confResultToString(result), errorLine);
+	}
+};
+
+} // namespace conf
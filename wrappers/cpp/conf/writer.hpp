@@ -20,8 +20,10 @@
 
 #pragma once
 #include "conf/error.hpp"
+#include "conf/field.hpp"
 #include <filesystem>
 #include <string_view>
+#include <type_traits>
 
 extern "C"
 {
@@ -39,6 +41,43 @@ class Writer final
 {
 private:
 	ConfWriter instance = nullptr;
+
+	template<typename T>
+	void writeField(const char* key, const T& value)
+	{
+		bool result;
+		if constexpr (is_same_v<T, bool>)
+		{
+			result = writeConfBool(instance, key, value);
+		}
+		else if constexpr (is_integral_v<T>)
+		{
+			if constexpr (is_unsigned_v<T> && sizeof(T) >= sizeof(int64_t))
+			{
+				if (value > (uint64_t)INT64_MAX)
+					throw Error("Struct field value is out of range");
+			}
+			result = writeConfInt(instance, key, (int64_t)value);
+		}
+		else if constexpr (is_floating_point_v<T>)
+		{
+			result = writeConfFloat(instance, key, (double)value, 0);
+		}
+		else if constexpr (is_same_v<T, string_view> || is_same_v<T, string>)
+		{
+			// Note: config has no empty string value, it can't be read back.
+			if (value.empty())
+				throw Error("Struct string field is empty");
+			result = writeConfString(instance, key, value.data(), value.size());
+		}
+		else
+		{
+			static_assert(!is_same_v<T, T>, "Unsupported Conf value type");
+		}
+
+		if (!result)
+			throw Error("Failed to write a struct field");
+	}
 public:
 	/**
 	 * @brief Creates a new Conf file writer instance.
@@ -83,6 +122,18 @@ public:
 			throw Error("Failed to write a new line");
 	}
 
+	/**
+	 * @brief Writes a section header to the config. ("[name]")
+	 * @details See the @ref writeConfSection().
+	 * @param[in] name target section name string
+	 * @throw Error on a section write failure.
+	 */
+	void writeSection(const string& name)
+	{
+		if (!writeConfSection(instance, name.c_str()))
+			throw Error("Failed to write a section");
+	}
+
 	/*******************************************************************************************************************
 	 * @brief Writes an integer value to the config. (int64)
 	 * @details See the @ref writeConfInt().
@@ -170,7 +221,7 @@ public:
 	 *
 	 * @param[in] key target item key string
 	 * @param value floating item value
-	 * @param precision number of digits after the decimal point, or 0 (auto detect).
+	 * @param precision maximum number of digits after the decimal point, or 0 (exact round trip).
 	 * 
 	 * @throw Error on a write failure.
 	 */
@@ -186,7 +237,7 @@ public:
 	 *
 	 * @param[in] key target item key string
 	 * @param value floating item value
-	 * @param precision number of digits after the decimal point, or 0 (auto detect).
+	 * @param precision maximum number of digits after the decimal point, or 0 (exact round trip).
 	 * 
 	 * @throw Error on a write failure.
 	 */
@@ -215,15 +266,40 @@ public:
 	 * @details See the @ref writeConfString().
 	 *
 	 * @param[in] key target item key string
-	 * @param[in] value string item value
+	 * @param[in] value string item value (not empty)
 	 * 
-	 * @throw Error on a write failure.
+	 * @throw Error on a write failure or if value is empty.
 	 */
 	void write(const string& key, string_view value)
 	{
+		if (value.empty())
+			throw Error("Empty string item value");
 		if (!writeConfString(instance, key.c_str(), value.data(), value.size()))
 			throw Error("Failed to write a string item");
 	}
+
+	/*******************************************************************************************************************
+	 * @brief Writes all struct fields to the config.
+	 * @details Items are written in the field order, to the buffered file stream.
+	 *
+	 * @param[in] value reference to the source struct
+	 * @param[in] fields tuple of the struct field descriptions (@ref field())
+	 * 
+	 * @throw Error on a write failure, or if a string field is empty.
+	 */
+	template<typename S, typename... F>
+	void save(const S& value, const tuple<F...>& fields)
+	{
+		apply([&](const auto&... field) { (writeField(field.key, value.*field.member), ...); }, fields);
+	}
+	/**
+	 * @brief Writes all struct fields to the config.
+	 * @details Uses the static S::confFields tuple, see the @ref save(const S&, const tuple<F...>&).
+	 * @param[in] value reference to the source struct
+	 * @throw Error on a write failure.
+	 */
+	template<typename S>
+	void save(const S& value) { save(value, S::confFields); }
 };
 
 } // namespace conf
\ No newline at end of file